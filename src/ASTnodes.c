@@ -7,59 +7,78 @@
  *
  * @brief Source file for AST nodes creating
  * Description of all nodes can be found in header file
+ * All nodes are allocated in AST arena, which is released after code generation
  */
 
 #include "ASTnodes.h"
 
+/**
+ * @brief Allocate AST node in AST arena and count it
+ */
+static void *ASTAlloc(size_t size) {
+  phase_counters[COUNTER_AST_NODES]++;
+  return ArenaAlloc(ARENA_AST, size);
+}
+
+/**
+ * @brief Get count of AST nodes created since start of program
+ */
+size_t ASTNodeCount() { return phase_counters[COUNTER_AST_NODES]; }
+
 ASTStart *CreateASTStart() {
-  ASTStart *ast_start = InvokeAlloc(sizeof(ASTStart));
+  ASTStart *ast_start = ASTAlloc(sizeof(ASTStart));
   ast_start->funcdecls = NULL;
   return ast_start;
 }
 
 ASTFuncDecl *CreateASTFuncDecl() {
-  ASTFuncDecl *ast_func_decl = InvokeAlloc(sizeof(ASTFuncDecl));
+  ASTFuncDecl *ast_func_decl = ASTAlloc(sizeof(ASTFuncDecl));
   ast_func_decl->next = NULL;
   ast_func_decl->variables = NULL;
   ast_func_decl->params = NULL;
   ast_func_decl->body = NULL;
+  ast_func_decl->first_token = TRACE_NO_TOKENS;
+  ast_func_decl->last_token = 0;
   return ast_func_decl;
 }
 
 ASTParam *CreateASTParam() {
-  ASTParam *ast_param = InvokeAlloc(sizeof(ASTParam));
+  ASTParam *ast_param = ASTAlloc(sizeof(ASTParam));
   ast_param->next = NULL;
   return ast_param;
 }
 
 ASTBody *CreateASTBody() {
-  ASTBody *ast_body = InvokeAlloc(sizeof(ASTBody));
+  ASTBody *ast_body = ASTAlloc(sizeof(ASTBody));
   ast_body->statement = NULL;
   return ast_body;
 }
 
 ASTStatement *CreateASTStatement() {
-  ASTStatement *ast_statement = InvokeAlloc(sizeof(ASTStatement));
+  ASTStatement *ast_statement = ASTAlloc(sizeof(ASTStatement));
   ast_statement->statement = NULL;
   ast_statement->next = NULL;
   return ast_statement;
 }
 
 ASTFuncCall *CreateASTFuncCall() {
-  ASTFuncCall *ast_func_call = InvokeAlloc(sizeof(ASTFuncCall));
+  ASTFuncCall *ast_func_call = ASTAlloc(sizeof(ASTFuncCall));
+  ast_func_call->builtin = BUILTIN_NONE;
+  ast_func_call->func_id = SYMTABLE_NO_FUNCTION;
+  ast_func_call->func = NULL;
   ast_func_call->params = NULL;
   return ast_func_call;
 }
 
 ASTParamCall *CreateASTParamCall() {
-  ASTParamCall *ast_param_call = InvokeAlloc(sizeof(ASTParamCall));
+  ASTParamCall *ast_param_call = ASTAlloc(sizeof(ASTParamCall));
   ast_param_call->next = NULL;
   ast_param_call->expr = NULL;
   return ast_param_call;
 }
 
 ASTVarDeclDef *CreateASTVarDeclDef() {
-  ASTVarDeclDef *ast_var_decl_def = InvokeAlloc(sizeof(ASTVarDeclDef));
+  ASTVarDeclDef *ast_var_decl_def = ASTAlloc(sizeof(ASTVarDeclDef));
   ast_var_decl_def->isIgnoring = false;
   ast_var_decl_def->name = NULL;
   ast_var_decl_def->expr = NULL;
@@ -67,14 +86,14 @@ ASTVarDeclDef *CreateASTVarDeclDef() {
 }
 
 ASTExpression *CreateASTExpression() {
-  ASTExpression *ast_expression = InvokeAlloc(sizeof(ASTExpression));
+  ASTExpression *ast_expression = ASTAlloc(sizeof(ASTExpression));
   ast_expression->exprStack = NULL;
   ast_expression->returnType = ST_NOT_DEFINED;
   return ast_expression;
 }
 
 ASTIfStatement *CreateASTIfStatement() {
-  ASTIfStatement *ast_if_statement = InvokeAlloc(sizeof(ASTIfStatement));
+  ASTIfStatement *ast_if_statement = ASTAlloc(sizeof(ASTIfStatement));
   ast_if_statement->elseBody = NULL;
   ast_if_statement->expr = NULL;
   ast_if_statement->ifBody = NULL;
@@ -83,7 +102,7 @@ ASTIfStatement *CreateASTIfStatement() {
 }
 
 ASTWhileStatement *CreateASTWhileStatement() {
-  ASTWhileStatement *ast_while_statement = InvokeAlloc(sizeof(ASTWhileStatement));
+  ASTWhileStatement *ast_while_statement = ASTAlloc(sizeof(ASTWhileStatement));
   ast_while_statement->expr = NULL;
   ast_while_statement->notNullID = NULL;
   ast_while_statement->whileBody = NULL;
@@ -91,7 +110,7 @@ ASTWhileStatement *CreateASTWhileStatement() {
 }
 
 ASTReturn *CreateASTReturn() {
-  ASTReturn *ast_return = InvokeAlloc(sizeof(ASTReturn));
+  ASTReturn *ast_return = ASTAlloc(sizeof(ASTReturn));
   ast_return->expr = NULL;
   return ast_return;
 }
\ No newline at end of file
@@ -11,7 +11,11 @@
 #ifndef ASTNODES_H
 #define ASTNODES_H
 
+#include "arena.h"
+#include "builtin.h"
 #include "memory.h"
+#include "phase.h"
+#include "trace.h"
 #include "stack.h"
 #include "symtable.h"
 
@@ -47,18 +51,20 @@ typedef struct ASTStart {
  * @brief AST node with function declaration information
  */
 typedef struct ASTFuncDecl {
-  char *name;       /**< Name of function*/
+  Atom *name;       /**< Name of function*/
   ASTParam *params; /**< Function parameters*/
-  List *variables;  /**< Dynamic array of all variables in function*/
+  VarSet *variables; /**< Ordered set of atoms of all variables in function*/
   ASTBody *body;    /**< All function statements are here*/
   ASTFuncDecl *next;/**< Next function declaration*/
+  size_t first_token; /**< Index of first token of body, for trace*/
+  size_t last_token;  /**< Index of last token of body, for trace*/
 } ASTFuncDecl;
 
 /**
  * @brief AST node with function parameter information
  */
 typedef struct ASTParam {
-  char *name;     /**< Name of function parameter*/
+  Atom *name;     /**< Name of function parameter*/
   ASTParam *next; /**< Next function parameter*/
 } ASTParam;
 
@@ -82,7 +88,10 @@ typedef struct ASTStatement {
  * @brief AST node for function call statement
  */
 typedef struct ASTFuncCall {
-  char *name;           /**< Name of function that is calling. Can be ifj.chr, etc..*/
+  Atom *name;           /**< Name of function that is calling. Can be ifj.chr, etc..*/
+  Builtin builtin;      /**< ifj function or BUILTIN_NONE for functions of program*/
+  unsigned int func_id; /**< Id of called function, SYMTABLE_NO_FUNCTION for ifj functions*/
+  func_data *func;      /**< Called function from symtable, NULL for ifj functions*/
   ASTParamCall *params; /**< First parameter of function call*/
 } ASTFuncCall;
 
@@ -99,7 +108,7 @@ typedef struct ASTParamCall {
  */
 typedef struct ASTVarDeclDef {
   bool isIgnoring;    /**< if its _ = ... statement*/
-  char *name;         /**< Name of variable*/
+  Atom *name;         /**< Name of variable*/
   ASTExpression *expr;/**< Expression for declaration/redefinition */
 } ASTVarDeclDef;
 
@@ -117,7 +126,7 @@ typedef struct ASTExpression {
  */
 typedef struct ASTIfStatement {
   ASTExpression *expr;  /**< boolean/nullable expression */
-  char* notNullID;      /**< Name of variable from nullable part */
+  Atom* notNullID;      /**< Name of variable from nullable part */
   ASTBody *ifBody;      /**< Body of if part */
   ASTBody *elseBody;    /**< Body of else part */
 } ASTIfStatement;
@@ -127,7 +136,7 @@ typedef struct ASTIfStatement {
  */
 typedef struct ASTWhileStatement {
   ASTExpression *expr;  /**< boolean/nullable expression */
-  char* notNullID;      /**< Name of variable from nullable part */
+  Atom* notNullID;      /**< Name of variable from nullable part */
   ASTBody *whileBody;   /**< Body of while */
 } ASTWhileStatement;
 
@@ -152,4 +161,6 @@ ASTIfStatement *CreateASTIfStatement();
 ASTWhileStatement *CreateASTWhileStatement();
 ASTReturn *CreateASTReturn();
 
+size_t ASTNodeCount();
+
 #endif
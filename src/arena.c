@@ -0,0 +1,195 @@
+/**
+ * @file arena.c
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Region allocators for compiler phases source file
+ *
+ * Every arena is a list of big chunks, which are allocated through
+ * InvokeAlloc, so they are freed on InvokeExit as everything else.
+ * Objects inside chunk are allocated by moving offset and are freed
+ * all at once by ArenaRelease at the end of their phase
+ */
+
+#include "arena.h"
+
+#define ARENA_CHUNK_SIZE 65536
+#define ARENA_ALIGN(size)                                                      \
+  (((size) + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1))
+
+/**
+ * @brief One continuous block of arena memory
+ */
+struct ArenaChunk {
+  ArenaChunk *prev; /**< Previously filled chunk*/
+  size_t used;      /**< Count of already allocated bytes*/
+  size_t capacity;  /**< Count of bytes in data*/
+  max_align_t data[]; /**< Memory for allocations*/
+};
+
+// Current chunk of every arena
+static ArenaChunk *arenas[ARENA_COUNT];
+
+// Names of arenas for memory statistics
+static const char *arena_names[ARENA_COUNT] = {"scanner arena", "AST arena",
+                                               "symtable arena", "expr arena",
+                                               "atom arena"};
+
+/**
+ * @brief Get pointer to the first free byte of chunk
+ */
+static char *ChunkTop(ArenaChunk *chunk) {
+  return (char *)chunk->data + chunk->used;
+}
+
+/**
+ * @brief Allocate new chunk and make it current for arena
+ *
+ * @param type Arena
+ * @param size Minimal count of bytes chunk has to contain
+ */
+static ArenaChunk *ArenaNewChunk(ArenaType type, size_t size) {
+  size_t capacity = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+  ArenaChunk *chunk = InvokeAllocNamed(sizeof(ArenaChunk) + capacity, arena_names[type]);
+  chunk->prev = arenas[type];
+  chunk->used = 0;
+  chunk->capacity = capacity;
+  arenas[type] = chunk;
+  return chunk;
+}
+
+/**
+ * @brief Allocate memory from arena
+ *
+ * @param type Arena
+ * @param size Size of memory that has to be allocated
+ *
+ * @return Pointer to allocated memory
+ */
+void *ArenaAlloc(ArenaType type, size_t size) {
+  if (size <= 0)
+    InvokeExit(INTERNAL_ERROR);
+  size = ARENA_ALIGN(size);
+  ArenaChunk *chunk = arenas[type];
+  if (chunk == NULL || chunk->capacity - chunk->used < size)
+    chunk = ArenaNewChunk(type, size);
+  void *element = ChunkTop(chunk);
+  chunk->used += size;
+  return element;
+}
+
+/**
+ * @brief Resize memory allocated from arena
+ * If it is last allocation of arena, it is resized in place
+ *
+ * @param type Arena
+ * @param element Pointer that has to be resized
+ * @param old_size Current size of element
+ * @param size New size of element (not additional)
+ *
+ * @return New pointer
+ */
+void *ArenaRealloc(ArenaType type, void *element, size_t old_size, size_t size) {
+  if (element == NULL)
+    return ArenaAlloc(type, size);
+
+  ArenaChunk *chunk = arenas[type];
+  size_t old_aligned = ARENA_ALIGN(old_size);
+  size_t new_aligned = ARENA_ALIGN(size);
+  // Grow or shrink in place
+  if ((char *)element + old_aligned == ChunkTop(chunk)) {
+    size_t offset = (char *)element - (char *)chunk->data;
+    if (offset + new_aligned <= chunk->capacity) {
+      chunk->used = offset + new_aligned;
+      return element;
+    }
+  } else if (size <= old_size) {
+    return element;
+  }
+
+  void *new_element = ArenaAlloc(type, size);
+  memcpy(new_element, element, old_size < size ? old_size : size);
+  return new_element;
+}
+
+/**
+ * @brief Perform strdup into arena
+ *
+ * @param type Arena
+ * @param s String that has to be copied
+ *
+ * @return Copied string
+ */
+char *ArenaStrdup(ArenaType type, const char *s) {
+  size_t size = strlen(s) + 1;
+  char *str = ArenaAlloc(type, size);
+  memcpy(str, s, size);
+  return str;
+}
+
+/**
+ * @brief Give memory back to arena
+ * Memory is reused only if it is last allocation, otherwise
+ * it stays allocated until arena is released
+ *
+ * @param type Arena
+ * @param element Pointer that has to be freed
+ * @param size Size of element
+ */
+void ArenaFree(ArenaType type, void *element, size_t size) {
+  ArenaChunk *chunk = arenas[type];
+  if (element == NULL || chunk == NULL)
+    return;
+  size = ARENA_ALIGN(size);
+  if ((char *)element + size == ChunkTop(chunk))
+    chunk->used -= size;
+}
+
+/**
+ * @brief Remember current position of arena
+ *
+ * @param type Arena
+ *
+ * @return Mark that can be passed to ArenaRewind
+ */
+ArenaMark ArenaGetMark(ArenaType type) {
+  ArenaMark mark;
+  mark.chunk = arenas[type];
+  mark.used = mark.chunk != NULL ? mark.chunk->used : 0;
+  return mark;
+}
+
+/**
+ * @brief Free everything that was allocated from arena after mark
+ *
+ * @param type Arena
+ * @param mark Mark from ArenaGetMark
+ */
+void ArenaRewind(ArenaType type, ArenaMark mark) {
+  while (arenas[type] != mark.chunk) {
+    ArenaChunk *prev = arenas[type]->prev;
+    // Keep first chunk for next allocations, arena is only emptied
+    if (prev == NULL && mark.chunk == NULL) {
+      arenas[type]->used = 0;
+      return;
+    }
+    InvokeFree(arenas[type]);
+    arenas[type] = prev;
+  }
+  if (arenas[type] != NULL)
+    arenas[type]->used = mark.used;
+}
+
+/**
+ * @brief Free whole arena at the end of phase
+ *
+ * @param type Arena
+ */
+void ArenaRelease(ArenaType type) {
+  while (arenas[type] != NULL) {
+    ArenaChunk *prev = arenas[type]->prev;
+    InvokeFree(arenas[type]);
+    arenas[type] = prev;
+  }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file arena.h
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Region allocators for compiler phases header file
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "error.h"
+#include "memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum ArenaType {
+  ARENA_SCANNER = 0, // Tokens and their strings
+  ARENA_AST,         // AST nodes, expression stacks
+  ARENA_SYMTABLE,    // Symtable items, keys and function parameters
+  ARENA_EXPR,        // Scratch memory of one expression parsing
+  ARENA_ATOM,        // Interned identifiers
+  ARENA_COUNT
+} ArenaType;
+
+typedef struct ArenaChunk ArenaChunk;
+
+/**
+ * @brief Position in arena, everything allocated after it can be rewinded
+ */
+typedef struct ArenaMark {
+  ArenaChunk *chunk;
+  size_t used;
+} ArenaMark;
+
+void *ArenaAlloc(ArenaType type, size_t size);
+void *ArenaRealloc(ArenaType type, void *element, size_t old_size, size_t size);
+char *ArenaStrdup(ArenaType type, const char *s);
+void ArenaFree(ArenaType type, void *element, size_t size);
+ArenaMark ArenaGetMark(ArenaType type);
+void ArenaRewind(ArenaType type, ArenaMark mark);
+void ArenaRelease(ArenaType type);
+
+#endif
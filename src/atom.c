@@ -0,0 +1,229 @@
+/**
+ * @file atom.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Interning table of identifiers
+ *
+ * Identifiers are interned by scanner, and the same Atom pointer
+ * is used by tokens, symtable keys, AST and code generator
+ */
+
+#include "atom.h"
+
+#define ATOM_TABLE_MIN 1024 // Initial capacity, must be power of 2
+
+// Open addressing table of atoms, capacity is power of 2
+static Atom **atom_table = NULL;
+static size_t atom_capacity = 0;
+static size_t atom_count = 0;
+
+// Atoms indexed by their id
+static Atom **atoms_by_id = NULL;
+static size_t atoms_by_id_capacity = 0;
+
+// Constants of wyhash
+#define HASH_P0 0xa0761d6478bd642full
+#define HASH_P1 0xe7037ed1a0db562full
+
+/**
+ * @brief Multiply to 128 bits and fold halves together
+ */
+static inline uint64_t HashMix(uint64_t a, uint64_t b) {
+  __uint128_t product = (__uint128_t)a * b;
+  return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+
+/**
+ * @brief Read 8 bytes as little endian number
+ */
+static inline uint64_t HashRead8(const char *p) {
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Read 4 bytes as little endian number
+ */
+static inline uint64_t HashRead4(const char *p) {
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Hash of identifier, wyhash (without its 48 byte loop,
+ * identifiers are short), every bit depends on every character
+ *
+ * @param str Identifier
+ * @param length Length of identifier
+ *
+ * @return Hash value
+ */
+uint64_t AtomHash(const char *str, size_t length) {
+  uint64_t seed = HashMix(HASH_P0, HASH_P1);
+  uint64_t a, b;
+  if (length <= 16) {
+    if (length >= 4) {
+      size_t middle = (length >> 3) << 2;
+      a = HashRead4(str) << 32 | HashRead4(str + middle);
+      b = HashRead4(str + length - 4) << 32 |
+          HashRead4(str + length - 4 - middle);
+    } else if (length > 0) {
+      a = (uint64_t)(unsigned char)str[0] << 16 |
+          (uint64_t)(unsigned char)str[length >> 1] << 8 |
+          (unsigned char)str[length - 1];
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    size_t rest = length;
+    const char *p = str;
+    while (rest > 16) {
+      seed = HashMix(HashRead8(p) ^ HASH_P1, HashRead8(p + 8) ^ seed);
+      p += 16;
+      rest -= 16;
+    }
+    a = HashRead8(p + rest - 16);
+    b = HashRead8(p + rest - 8);
+  }
+  a ^= HASH_P1;
+  b ^= seed;
+  __uint128_t product = (__uint128_t)a * b;
+  a = (uint64_t)product;
+  b = (uint64_t)(product >> 64);
+  return HashMix(a ^ HASH_P0 ^ length, b ^ HASH_P1);
+}
+
+/**
+ * @brief Allocate empty table of given capacity
+ */
+static void AtomTableAlloc(size_t capacity) {
+  atom_table = InvokeAlloc(sizeof(Atom *) * capacity);
+  memset(atom_table, 0, sizeof(Atom *) * capacity);
+  atom_capacity = capacity;
+}
+
+/**
+ * @brief Initialize interning table
+ */
+void AtomTableInit() {
+  AtomTableAlloc(ATOM_TABLE_MIN);
+  atom_count = 0;
+}
+
+/**
+ * @brief Free all atoms and table
+ */
+void AtomTableClear() {
+  InvokeFree(atom_table);
+  InvokeFree(atoms_by_id);
+  atom_table = NULL;
+  atoms_by_id = NULL;
+  atom_capacity = 0;
+  atoms_by_id_capacity = 0;
+  atom_count = 0;
+  ArenaRelease(ARENA_ATOM);
+}
+
+/**
+ * @brief Double capacity of table when it is half full
+ */
+static void AtomTableGrow() {
+  Atom **old_table = atom_table;
+  size_t old_capacity = atom_capacity;
+
+  AtomTableAlloc(old_capacity * 2);
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_table[i] == NULL)
+      continue;
+    size_t index = old_table[i]->hash & (atom_capacity - 1);
+    while (atom_table[index] != NULL)
+      index = (index + 1) & (atom_capacity - 1);
+    atom_table[index] = old_table[i];
+  }
+  InvokeFree(old_table);
+}
+
+/**
+ * @brief Get unique atom for identifier, create it if it doesn't exist yet
+ *
+ * @param str Identifier (doesn't have to be null terminated)
+ * @param length Length of identifier
+ *
+ * @return Atom of identifier
+ */
+Atom *AtomIntern(const char *str, size_t length) {
+  return AtomInternHashed(str, length, AtomHash(str, length));
+}
+
+/**
+ * @brief Get unique atom for identifier whose hash is already known
+ *
+ * @param str Identifier (doesn't have to be null terminated)
+ * @param length Length of identifier
+ * @param hash AtomHash of identifier
+ *
+ * @return Atom of identifier
+ */
+Atom *AtomInternHashed(const char *str, size_t length, uint64_t hash) {
+  if (atom_table == NULL)
+    AtomTableInit();
+
+  size_t index = hash & (atom_capacity - 1);
+  while (atom_table[index] != NULL) {
+    Atom *atom = atom_table[index];
+    if (atom->hash == hash && atom->length == length &&
+        memcmp(atom->str, str, length) == 0)
+      return atom;
+    index = (index + 1) & (atom_capacity - 1);
+  }
+
+  // New atom, name is stored right after structure
+  Atom *atom = ArenaAlloc(ARENA_ATOM, sizeof(Atom) + length + 1);
+  char *name = (char *)(atom + 1);
+  memcpy(name, str, length);
+  name[length] = '\0';
+  atom->str = name;
+  atom->length = length;
+  atom->hash = hash;
+  atom->id = atom_count++;
+  atom_table[index] = atom;
+
+  if (atom->id == atoms_by_id_capacity) {
+    atoms_by_id_capacity = atoms_by_id_capacity == 0 ? ATOM_TABLE_MIN
+                                                     : atoms_by_id_capacity * 2;
+    atoms_by_id = InvokeRealloc(atoms_by_id, sizeof(Atom *) * atoms_by_id_capacity);
+  }
+  atoms_by_id[atom->id] = atom;
+
+  if (atom_count * 2 > atom_capacity)
+    AtomTableGrow();
+  return atom;
+}
+
+/**
+ * @brief Get atom for null terminated identifier
+ *
+ * @param str Identifier
+ *
+ * @return Atom of identifier
+ */
+Atom *AtomInternStr(const char *str) { return AtomIntern(str, strlen(str)); }
+
+/**
+ * @brief Get atom by its id
+ *
+ * @param id Id of existing atom
+ *
+ * @return Atom with this id
+ */
+Atom *AtomById(unsigned int id) { return atoms_by_id[id]; }
+
+/**
+ * @brief Get count of interned atoms
+ */
+size_t AtomCount() { return atom_count; }
@@ -0,0 +1,42 @@
+/**
+ * @file atom.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Interning table of identifiers header
+ */
+
+#ifndef ATOM_H
+#define ATOM_H
+
+#include "arena.h"
+#include "error.h"
+#include "memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Interned identifier
+ * Every identifier exists only once, so two atoms are equal
+ * only if their pointers are equal
+ */
+typedef struct Atom {
+  const char *str; /**< Null terminated name*/
+  size_t length;   /**< Length of name*/
+  uint64_t hash;   /**< Hash of name, computed once when lexed*/
+  unsigned int id; /**< Unique number of atom (order of interning)*/
+} Atom;
+
+void AtomTableInit();
+void AtomTableClear();
+uint64_t AtomHash(const char *str, size_t length);
+Atom *AtomIntern(const char *str, size_t length);
+Atom *AtomInternHashed(const char *str, size_t length, uint64_t hash);
+Atom *AtomInternStr(const char *str);
+Atom *AtomById(unsigned int id);
+size_t AtomCount();
+
+#endif // ATOM_H
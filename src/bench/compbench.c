@@ -0,0 +1,217 @@
+/**
+ * @file compbench.c
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Throughput benchmark of compiler phases
+ *
+ * Usage: ./compbench FILE [ITERATIONS] [--json]
+ * Whole compilation of FILE runs ITERATIONS times, GenerateTokens and
+ * every phase of ParseWithHooks (the pipeline main runs by Parse) are timed
+ * separately and the best time of every phase is reported. Generated code goes to /dev/null,
+ * report goes to stdout as table or as JSON for comparing releases
+ */
+
+#include "../ASTnodes.h"
+#include "../atom.h"
+#include "../memory.h"
+#include "../parser.h"
+#include "../scanner.h"
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+
+// Lexing, then phases of ParseWithHooks
+#define PHASE_LEX 0
+#define PHASE_OF(parse_phase) ((parse_phase) + 1)
+#define PHASE_COUNT PHASE_OF(PARSE_PHASE_COUNT)
+
+/**
+ * @brief Results of one phase
+ */
+typedef struct PhaseResult {
+  double best; /**< Seconds of the fastest iteration*/
+  double sum;  /**< Seconds of all iterations*/
+} PhaseResult;
+
+static PhaseResult results[PHASE_COUNT];
+
+/**
+ * @brief Current time in seconds from monotonic clock
+ */
+static double Now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Add time of phase to its results
+ */
+static void Record(int phase, double start) {
+  double seconds = Now() - start;
+  if (results[phase].sum == 0 || seconds < results[phase].best)
+    results[phase].best = seconds;
+  results[phase].sum += seconds;
+}
+
+/**
+ * @brief State of timed compilation, context of ParseHook
+ */
+typedef struct BenchRun {
+  double start;       /**< Start of current phase*/
+  size_t nodes_start; /**< Count of AST nodes before ParseProlog*/
+  size_t nodes;       /**< AST nodes created by ParseProlog*/
+} BenchRun;
+
+/**
+ * @brief Hook of ParseWithHooks, times every phase
+ */
+static void BenchHook(ParsePhase phase, bool begin, void *context) {
+  BenchRun *run = context;
+  if (begin) {
+    if (phase == PARSE_PROLOG)
+      run->nodes_start = ASTNodeCount();
+    run->start = Now();
+    return;
+  }
+  // Generated code has to be written to be counted
+  if (phase == PARSE_CGEN)
+    fflush(stdout);
+  Record(PHASE_OF(phase), run->start);
+  if (phase == PARSE_PROLOG)
+    run->nodes = ASTNodeCount() - run->nodes_start;
+}
+
+/**
+ * @brief Compile file once as main does, with every phase timed
+ *
+ * @param tokens Count of tokens
+ * @param nodes Count of AST nodes
+ */
+static void Compile(const char *path, size_t *tokens, size_t *nodes) {
+  FILE *file = fopen(path, "r");
+  if (file == NULL)
+    InvokeExit(INTERNAL_ERROR);
+
+  AllocatorInit();
+  AtomTableInit();
+  ScannerInit(file);
+
+  double start = Now();
+  GenerateTokens();
+  Record(PHASE_LEX, start);
+  *tokens = scanner->size;
+
+  BenchRun run = {0, 0, 0};
+  ParseWithHooks(BenchHook, &run);
+  *nodes = run.nodes;
+
+  ScannerDestroy();
+  SymtableClear();
+  AtomTableClear();
+  AllocatorDestroy();
+}
+
+/**
+ * @brief Name of phase in report
+ */
+static const char *BenchPhaseName(int phase) {
+  return phase == PHASE_LEX ? "GenerateTokens" : ParsePhaseName(phase - 1);
+}
+
+/**
+ * @brief Count per second, 0 for phase too short to be measured
+ */
+static double Rate(double count, double seconds) {
+  return seconds > 0 ? count / seconds : 0;
+}
+
+/**
+ * @brief Print results as aligned table
+ */
+static void PrintTable(FILE *out, const char *path, size_t bytes,
+                       size_t tokens, size_t nodes, int iterations,
+                       long peak_rss) {
+  fprintf(out, "%s: %zu bytes, %zu tokens, %zu AST nodes, %d iterations\n",
+          path, bytes, tokens, nodes, iterations);
+  fprintf(out, "%-22s %10s %10s %12s %12s %12s\n", "phase", "best ms",
+          "mean ms", "MB/s", "Mtokens/s", "Mnodes/s");
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    double best = results[i].best;
+    fprintf(out, "%-22s %10.3f %10.3f %12.2f %12.2f %12.2f\n", BenchPhaseName(i),
+            best * 1e3, results[i].sum / iterations * 1e3,
+            Rate(bytes, best) / 1e6, Rate(tokens, best) / 1e6,
+            Rate(nodes, best) / 1e6);
+  }
+  fprintf(out, "peak RSS: %ld KiB\n", peak_rss);
+}
+
+/**
+ * @brief Print results as JSON object
+ */
+static void PrintJson(FILE *out, const char *path, size_t bytes,
+                      size_t tokens, size_t nodes, int iterations,
+                      long peak_rss) {
+  fprintf(out, "{\n  \"file\": ");
+  TraceJsonString(out, path);
+  fprintf(out, ",\n");
+  fprintf(out, "  \"bytes\": %zu,\n  \"tokens\": %zu,\n", bytes, tokens);
+  fprintf(out, "  \"ast_nodes\": %zu,\n  \"iterations\": %d,\n", nodes,
+          iterations);
+  fprintf(out, "  \"peak_rss_kib\": %ld,\n  \"phases\": {\n", peak_rss);
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    double best = results[i].best;
+    fprintf(out,
+            "    \"%s\": {\"best_s\": %.9f, \"mean_s\": %.9f, "
+            "\"mb_per_s\": %.3f, \"tokens_per_s\": %.0f, "
+            "\"ast_nodes_per_s\": %.0f}%s\n",
+            BenchPhaseName(i), best, results[i].sum / iterations,
+            Rate(bytes, best) / 1e6, Rate(tokens, best), Rate(nodes, best),
+            i + 1 < PHASE_COUNT ? "," : "");
+  }
+  fprintf(out, "  }\n}\n");
+}
+
+int main(int argc, char *argv[]) {
+  const char *path = NULL;
+  int iterations = 10;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--json") == 0)
+      json = true;
+    else if (path == NULL)
+      path = argv[i];
+    else
+      iterations = atoi(argv[i]);
+  }
+
+  struct stat st;
+  if (path == NULL || stat(path, &st) != 0 || iterations <= 0) {
+    fprintf(stderr, "Usage: %s FILE [ITERATIONS] [--json]\n", argv[0]);
+    return INTERNAL_ERROR;
+  }
+
+  // Code generator writes to stdout, report goes to its original target
+  FILE *report = fdopen(dup(STDOUT_FILENO), "w");
+  if (report == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+    fprintf(stderr, "Can't redirect output\n");
+    return INTERNAL_ERROR;
+  }
+
+  size_t tokens = 0, nodes = 0;
+  for (int i = 0; i < iterations; i++)
+    Compile(path, &tokens, &nodes);
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  if (json)
+    PrintJson(report, path, st.st_size, tokens, nodes, iterations,
+              usage.ru_maxrss);
+  else
+    PrintTable(report, path, st.st_size, tokens, nodes, iterations,
+               usage.ru_maxrss);
+  fclose(report);
+  return 0;
+}
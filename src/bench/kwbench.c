@@ -0,0 +1,116 @@
+/**
+ * @file kwbench.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Keyword recognition microbenchmark
+ *
+ * Usage: ./kwbench [ROUNDS]
+ * Compares perfect hash KeywordLookup with former chain of StringEquals
+ * on mix of keywords and ordinary identifiers
+ */
+
+#include "../jm_string.h"
+#include "../keyword.h"
+#include "../memory.h"
+#include <time.h>
+
+#define IDENTIFIERS 4096
+
+/**
+ * @brief Current time in seconds from monotonic clock
+ */
+static double Now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Keyword recognition as it was before perfect hash
+ */
+static Keyword ChainLookup(String *str) {
+  if (StringEquals(str, "const"))
+    return K_CONST;
+  if (StringEquals(str, "else"))
+    return K_ELSE;
+  if (StringEquals(str, "fn"))
+    return K_FN;
+  if (StringEquals(str, "if"))
+    return K_IF;
+  if (StringEquals(str, "i32"))
+    return K_I32;
+  if (StringEquals(str, "f64"))
+    return K_F64;
+  if (StringEquals(str, "null"))
+    return K_NULL;
+  if (StringEquals(str, "pub"))
+    return K_PUB;
+  if (StringEquals(str, "return"))
+    return K_RETURN;
+  if (StringEquals(str, "u8"))
+    return K_U8;
+  if (StringEquals(str, "var"))
+    return K_VAR;
+  if (StringEquals(str, "void"))
+    return K_VOID;
+  if (StringEquals(str, "while"))
+    return K_WHILE;
+  if (StringEquals(str, "ifj"))
+    return K_IFJ;
+  return K_UNKNOWN;
+}
+
+int main(int argc, char *argv[]) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 2000;
+  if (rounds <= 0) {
+    fprintf(stderr, "Usage: %s [ROUNDS]\n", argv[0]);
+    return INTERNAL_ERROR;
+  }
+  AllocatorInit();
+
+  // Every 5th identifier is keyword, others look like ordinary code
+  static const char *names[] = {"i", "x", "result", "counter", "tmp_000123",
+                                "value", "ifjx", "whiles", "u16", "returned",
+                                "str", "n", "index", "f", "voidptr"};
+  String *identifiers[IDENTIFIERS];
+  srand(42);
+  for (int i = 0; i < IDENTIFIERS; i++) {
+    identifiers[i] = StringNew();
+    if (i % 5 == 0)
+      PushString(identifiers[i], KeywordName(rand() % K_COUNT));
+    else
+      PushString(identifiers[i], names[rand() % (sizeof(names) / sizeof(*names))]);
+  }
+
+  for (int i = 0; i < IDENTIFIERS; i++) {
+    if (ChainLookup(identifiers[i]) !=
+        KeywordLookup(identifiers[i]->str, identifiers[i]->length)) {
+      fprintf(stderr, "lookups differ for %s\n", identifiers[i]->str);
+      InvokeExit(INTERNAL_ERROR);
+    }
+  }
+
+  // Sum of results keeps compiler from removing lookups
+  long sum = 0;
+  double start = Now();
+  for (int r = 0; r < rounds; r++)
+    for (int i = 0; i < IDENTIFIERS; i++)
+      sum += ChainLookup(identifiers[i]);
+  double chain = Now() - start;
+
+  start = Now();
+  for (int r = 0; r < rounds; r++)
+    for (int i = 0; i < IDENTIFIERS; i++)
+      sum -= KeywordLookup(identifiers[i]->str, identifiers[i]->length);
+  double hash = Now() - start;
+
+  double total = (double)rounds * IDENTIFIERS;
+  printf("chain    %10.2f Mident/s\n", total / chain / 1e6);
+  printf("hash     %10.2f Mident/s\n", total / hash / 1e6);
+  printf("speedup: %.2fx%s\n", chain / hash, sum != 0 ? " (results differ)" : "");
+
+  AllocatorDestroy();
+  return 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file lexbench.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Lexing throughput benchmark of table-driven and hand-coded scanner
+ *
+ * Usage: ./lexbench FILE [ITERATIONS]
+ * Both engines are checked to produce the same tokens first, then every
+ * engine lexes whole file ITERATIONS times, table-driven engine once for
+ * every level of run kernels supported by CPU.
+ * At last token arrays from serial and parallel GenerateTokens are compared
+ * and both are measured
+ */
+
+#include "../atom.h"
+#include "../memory.h"
+#include "../scanner.h"
+#include "../scanrun.h"
+#include "switchlex.h"
+#include <sys/stat.h>
+#include <time.h>
+
+typedef int (*Engine)(Token *token);
+
+// Input has lexical error, GenerateTokens can't be run
+static bool lex_error = false;
+
+/**
+ * @brief Current time in seconds from monotonic clock
+ */
+static double Now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Check if two tokens are the same
+ */
+static bool TokenEquals(Token *a, Token *b) {
+  if (a->type != b->type || a->keyword != b->keyword)
+    return false;
+  switch (a->type) {
+  case T_ID:
+    return a->keyword != K_UNKNOWN || a->value.atom == b->value.atom;
+  case T_INT:
+    return a->value.integer == b->value.integer;
+  case T_FLOAT:
+    return a->value.real == b->value.real;
+  case T_STR:
+    return a->value.string->length == b->value.string->length &&
+           memcmp(a->value.string->str, b->value.string->str,
+                  a->value.string->length) == 0;
+  default:
+    return true;
+  }
+}
+
+/**
+ * @brief Lex whole input with both engines and compare tokens
+ *
+ * @return Count of tokens or 0 if engines differ
+ */
+static size_t Verify() {
+  size_t capacity = 1024, count = 0;
+  Token *tokens = InvokeAlloc(sizeof(Token) * capacity);
+  int status;
+
+  SwitchLexRewind();
+  do {
+    if (count == capacity) {
+      capacity *= 2;
+      tokens = InvokeRealloc(tokens, sizeof(Token) * capacity);
+    }
+    status = SwitchLexGetToken(&tokens[count]);
+  } while (status == OK && tokens[count++].type != T_EOF);
+
+  ScannerRewind();
+  for (size_t i = 0; i < count; i++) {
+    Token token;
+    if (GetToken(&token) != OK || !TokenEquals(&token, &tokens[i])) {
+      fprintf(stderr, "engines differ at token %zu\n", i);
+      return 0;
+    }
+  }
+  if (status != OK) {
+    Token token;
+    if (GetToken(&token) == OK) {
+      fprintf(stderr, "engines differ at token %zu\n", count);
+      return 0;
+    }
+    fprintf(stderr, "lexical error after %zu tokens\n", count);
+    lex_error = true;
+  }
+  InvokeFree(tokens);
+  return count;
+}
+
+/**
+ * @brief Lex whole input with engine, both engines are rewound
+ *
+ * @return Count of tokens
+ */
+static size_t Run(Engine engine) {
+  size_t count = 0;
+  Token token;
+  ScannerRewind();
+  SwitchLexRewind();
+  while (engine(&token) == OK && token.type != T_EOF) {
+    if (token.type == T_STR)
+      FreeString(token.value.string);
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief Measure engine and print its throughput
+ *
+ * @return Seconds for one pass
+ */
+static double Measure(const char *name, Engine engine, int iterations,
+                      size_t bytes) {
+  size_t tokens = 0;
+  double start = Now();
+  for (int i = 0; i < iterations; i++)
+    tokens = Run(engine);
+  double pass = (Now() - start) / iterations;
+  printf("%-8s %10.2f MB/s %10.2f Mtokens/s %10.3f ms/pass\n", name,
+         bytes / pass / 1e6, tokens / pass / 1e6, pass * 1e3);
+  return pass;
+}
+
+/**
+ * @brief Copy of token arrays made by GenerateTokens
+ */
+typedef struct TokenArrays {
+  size_t size;
+  unsigned char *types;
+  signed char *keywords;
+  uint32_t *offsets;
+  uint32_t *lengths;
+  uint32_t *values;
+} TokenArrays;
+
+/**
+ * @brief Generate tokens with given count of threads and copy token arrays
+ */
+static void Generate(size_t threads, TokenArrays *arrays) {
+  ScannerRewind();
+  ScannerSetThreads(threads);
+  GenerateTokens();
+  size_t n = scanner->size;
+  arrays->size = n;
+  arrays->types = InvokeAlloc(n);
+  arrays->keywords = InvokeAlloc(n);
+  arrays->offsets = InvokeAlloc(sizeof(uint32_t) * n);
+  arrays->lengths = InvokeAlloc(sizeof(uint32_t) * n);
+  arrays->values = InvokeAlloc(sizeof(uint32_t) * n);
+  memcpy(arrays->types, scanner->types, n);
+  memcpy(arrays->keywords, scanner->keywords, n);
+  memcpy(arrays->offsets, scanner->offsets, sizeof(uint32_t) * n);
+  memcpy(arrays->lengths, scanner->lengths, sizeof(uint32_t) * n);
+  memcpy(arrays->values, scanner->values, sizeof(uint32_t) * n);
+}
+
+/**
+ * @brief Compare token arrays of serial GenerateTokens with the current ones,
+ * floats and strings are compared through tokens
+ *
+ * @return true if they are the same
+ */
+static bool VerifyParallel(size_t threads) {
+  TokenArrays serial, parallel;
+  Generate(1, &serial);
+  Token *tokens = InvokeAlloc(sizeof(Token) * serial.size);
+  for (size_t i = 0; i < serial.size; i++)
+    ScannerGetToken(i, &tokens[i]);
+
+  Generate(threads, &parallel);
+  bool same = serial.size == parallel.size;
+  size_t n = serial.size;
+  same = same && memcmp(serial.types, parallel.types, n) == 0 &&
+         memcmp(serial.keywords, parallel.keywords, n) == 0 &&
+         memcmp(serial.offsets, parallel.offsets, sizeof(uint32_t) * n) == 0 &&
+         memcmp(serial.lengths, parallel.lengths, sizeof(uint32_t) * n) == 0 &&
+         memcmp(serial.values, parallel.values, sizeof(uint32_t) * n) == 0;
+  for (size_t i = 0; same && i < n; i++) {
+    Token token;
+    ScannerGetToken(i, &token);
+    same = TokenEquals(&token, &tokens[i]);
+  }
+  if (!same)
+    fprintf(stderr, "parallel lexing with %zu threads differs\n", threads);
+  InvokeFree(tokens);
+  return same;
+}
+
+/**
+ * @brief Measure GenerateTokens with given count of threads
+ *
+ * @return Seconds for one pass
+ */
+static double MeasureGenerate(const char *name, size_t threads, int iterations,
+                              size_t bytes) {
+  ScannerSetThreads(threads);
+  double start = Now();
+  for (int i = 0; i < iterations; i++) {
+    ScannerRewind();
+    GenerateTokens();
+  }
+  double pass = (Now() - start) / iterations;
+  printf("%-8s %10.2f MB/s %10.2f Mtokens/s %10.3f ms/pass\n", name,
+         bytes / pass / 1e6, scanner->size / pass / 1e6, pass * 1e3);
+  return pass;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s FILE [ITERATIONS]\n", argv[0]);
+    return INTERNAL_ERROR;
+  }
+  int iterations = argc > 2 ? atoi(argv[2]) : 20;
+  FILE *file = fopen(argv[1], "r");
+  struct stat st;
+  if (file == NULL || fstat(fileno(file), &st) != 0 || iterations <= 0) {
+    fprintf(stderr, "Can't open %s\n", argv[1]);
+    return INTERNAL_ERROR;
+  }
+
+  AllocatorInit();
+  AtomTableInit();
+  SwitchLexInit(file);
+  ScannerInit(file);
+
+  ScanLevel best = ScanRunInit();
+  size_t tokens = 0;
+  for (ScanLevel level = SCAN_SCALAR; level <= best; level++) {
+    if (ScanRunSelect(level) && (tokens = Verify()) == 0)
+      InvokeExit(INTERNAL_ERROR);
+  }
+  printf("%s: %lld bytes, %zu tokens, %d iterations\n", argv[1],
+         (long long)st.st_size, tokens, iterations);
+
+  double hand = Measure("switch", SwitchLexGetToken, iterations, st.st_size);
+  for (ScanLevel level = SCAN_SCALAR; level <= best; level++) {
+    if (!ScanRunSelect(level))
+      continue;
+    double table = Measure(ScanLevelName(level), GetToken, iterations,
+                           st.st_size);
+    printf("table-driven %s speedup: %.2fx\n", ScanLevelName(level),
+           hand / table);
+  }
+
+  if (!lex_error) {
+    for (size_t threads = 2; threads <= 16; threads *= 2) {
+      if (!VerifyParallel(threads))
+        InvokeExit(INTERNAL_ERROR);
+    }
+    double serial = MeasureGenerate("serial", 1, iterations, st.st_size);
+    double parallel = MeasureGenerate("parallel", 0, iterations, st.st_size);
+    printf("parallel GenerateTokens speedup: %.2fx\n", serial / parallel);
+  }
+
+  ScannerDestroy();
+  SwitchLexDestroy();
+  AtomTableClear();
+  AllocatorDestroy();
+  return 0;
+}
@@ -0,0 +1,509 @@
+/**
+ * @file switchlex.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Hand-coded switch scanner, reference engine of lexbench
+ *
+ * Scanner as it was before table-driven GetToken: one switch per character,
+ * numbers are collected to their own String and converted by libc.
+ * It lexes its own copy of input, so it's independent of scanner state
+ */
+
+#include "switchlex.h"
+
+// Macro for 1 character token
+#define CASE_T(C, T)                                                           \
+  case C:                                                                      \
+    token->type = T;                                                           \
+    return OK
+
+// Macro for changing states
+#define CASE_S(C, S)                                                           \
+  case C:                                                                      \
+    state = S;                                                                 \
+    break
+
+typedef enum State {
+  S_ERR = -1,
+  S_START,
+  S_LT,
+  S_GT,
+  S_EQ,
+  S_NEQ,
+  S_DIV,
+  S_INT0,
+  S_INT1,
+  S_DOT,
+  S_FLOAT_E,
+  S_FLOAT_D,
+  S_EXPS,
+  S_EXP,
+  S_STR,
+  S_MLSTR,
+  S_ID,
+  S_UNDERSCORE
+} State;
+
+// Whole input and position of next character
+static unsigned char *data;
+static size_t length;
+static size_t pos;
+
+// Reusable buffer for identifier text
+static String *scratch;
+
+/**
+ * @brief Read whole file, file position is returned to start,
+ * so file can be passed to ScannerInit afterwards
+ *
+ * @param f File
+ */
+void SwitchLexInit(FILE *f) {
+  size_t capacity = 65536;
+  data = InvokeAlloc(capacity);
+  length = 0;
+  size_t count;
+  while ((count = fread(data + length, 1, capacity - length, f)) > 0) {
+    length += count;
+    if (length == capacity) {
+      capacity *= 2;
+      data = InvokeRealloc(data, capacity);
+    }
+  }
+  rewind(f);
+  pos = 0;
+  scratch = StringNew();
+}
+
+/**
+ * @brief Start lexing from beginning of input
+ */
+void SwitchLexRewind() { pos = 0; }
+
+/**
+ * @brief Free input and buffer
+ */
+void SwitchLexDestroy() {
+  InvokeFree(data);
+  FreeString(scratch);
+}
+
+/**
+ * @brief Get next character of input
+ *
+ * @return Character as unsigned char or EOF
+ */
+static int NextChar() { return pos < length ? data[pos++] : EOF; }
+
+/**
+ * @brief Return last read character back to input
+ *
+ * @param c Last read character
+ */
+static void UngetChar(int c) {
+  if (c != EOF)
+    pos--;
+}
+
+/**
+ * @brief Get empty identifier buffer
+ *
+ * @return Identifier buffer
+ */
+static String *ScratchReset() {
+  scratch->length = 0;
+  scratch->str[0] = '\0';
+  return scratch;
+}
+
+/**
+ * @brief Get value of hexadecimal digit
+ *
+ * @return Value or -1 if char isn't hexadecimal digit
+ */
+static int HexValue(int c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+    return (c | 0x20) - 'a' + 10;
+  return -1;
+}
+
+/**
+ * @brief Get value of escape sequence, backslash is already read
+ *
+ * @return Value of escaped char or -1 for invalid escape
+ */
+static int GetEscapeSequence() {
+  int c = NextChar();
+  switch (c) {
+  case '"':
+    return '"';
+  case 'n':
+    return '\n';
+  case 'r':
+    return '\r';
+  case 't':
+    return '\t';
+  case '\\':
+    return '\\';
+  case 'x':
+    break;
+  default:
+    return -1;
+  }
+  int first = HexValue(NextChar());
+  int second = HexValue(NextChar());
+
+  // Check if first and second char is hex
+  if (first < 0 || second < 0)
+    return -1;
+  return first * 16 + second;
+}
+
+/**
+ * @brief Convert integer literal
+ *
+ * @param str Digits of literal
+ * @param value Value of literal
+ * @return OK or LEXICAL_ERROR if literal doesn't fit to i32
+ */
+static int ParseInteger(String *str, int *value) {
+  long long result = strtoll(str->str, NULL, 10);
+  if (result > INT32_MAX)
+    return LEXICAL_ERROR;
+  *value = (int)result;
+  return OK;
+}
+
+/**
+ * @brief Get the next token from the input file
+ * Hand-coded automaton from docs/FSM.png
+ *
+ * @param token Pointer to the token structure to store the result
+ * @return Status code (OK or LEXICAL_ERROR)
+ */
+int SwitchLexGetToken(Token *token) {
+  int c;
+  String *str = NULL;
+  token->value.string = NULL;
+  token->keyword = K_UNKNOWN;
+  State state = S_START;
+
+  // Main scanner loop
+  do {
+    c = NextChar();
+    switch (state) {
+    case S_START:
+      if (isspace(c)) {
+        continue;
+      }
+      switch (c) {
+        CASE_T(EOF, T_EOF);
+        CASE_T('.', T_DOT);
+        CASE_T(';', T_SEMICOLON);
+        CASE_T(':', T_COLON);
+        CASE_T(',', T_COMMA);
+        CASE_T('(', T_OPAREN);
+        CASE_T(')', T_CPAREN);
+        CASE_T('[', T_OSQUARE);
+        CASE_T(']', T_CSQUARE);
+        CASE_T('{', T_OCURLY);
+        CASE_T('}', T_CCURLY);
+        CASE_T('|', T_PIPE);
+        CASE_T('@', T_AT);
+        CASE_T('?', T_QUESTM);
+        CASE_T('+', T_PLUS);
+        CASE_T('-', T_SUB);
+        CASE_T('*', T_MUL);
+
+        CASE_S('>', S_GT);
+        CASE_S('<', S_LT);
+        CASE_S('=', S_EQ);
+        CASE_S('!', S_NEQ);
+        CASE_S('/', S_DIV);
+      case '"': {
+        str = StringNew();
+        state = S_STR;
+        break;
+      }
+      case '\\': {
+        str = StringNew();
+        state = S_MLSTR;
+        break;
+      }
+
+      case '0': {
+        str = StringNew();
+        PushChar(str, c);
+        state = S_INT0;
+        break;
+      }
+
+      case '1' ... '9': {
+        str = StringNew();
+        PushChar(str, c);
+        state = S_INT1;
+        break;
+      }
+
+      case '_': {
+        str = ScratchReset();
+        PushChar(str, c);
+        state = S_UNDERSCORE;
+        break;
+      }
+
+      case 'a' ... 'z':
+      case 'A' ... 'Z':
+        str = ScratchReset();
+        PushChar(str, c);
+        state = S_ID;
+        break;
+
+      default:
+        return LEXICAL_ERROR;
+      }
+      break;
+    case S_UNDERSCORE:
+      // If char is alphanumeric or underscore
+      if (isalnum(c) || c == '_') {
+        PushChar(str, c);
+        state = S_ID;
+      // Else return underscore token
+      } else {
+        UngetChar(c);
+        token->type = T_UNDERSCORE;
+        return OK;
+      }
+      break;
+    case S_ID: {
+      if (isalnum(c) || c == '_') {
+        PushChar(str, c);
+      } else {
+        UngetChar(c);
+        Keyword keyword = KeywordLookup(str->str, str->length);
+        if (keyword != K_UNKNOWN) {
+          token->type = T_ID;
+          token->keyword = keyword;
+        } else {
+          token->type = T_ID;
+          token->value.atom = AtomIntern(str->str, str->length);
+        }
+        return OK;
+      }
+      break;
+    }
+    case S_INT0: {
+      if (c == '.') {
+        PushChar(str, c);
+        state = S_DOT;
+      } else if (c == 'e' || c == 'E') {
+        PushChar(str, c);
+        state = S_EXP;
+      } else if (c >= '0' && c <= '9') {
+        FreeString(str);
+        return LEXICAL_ERROR;
+      } else {
+        UngetChar(c);
+        token->type = T_INT;
+        int status = ParseInteger(str, &token->value.integer);
+        FreeString(str);
+        return status;
+      }
+      break;
+    }
+    case S_INT1: {
+      if (c >= '0' && c <= '9') {
+        PushChar(str, c);
+      } else if (c == '.') {
+        PushChar(str, c);
+        state = S_DOT;
+      } else if (c == 'e' || c == 'E') {
+        PushChar(str, c);
+        state = S_EXP;
+      } else {
+        UngetChar(c);
+        token->type = T_INT;
+        int status = ParseInteger(str, &token->value.integer);
+        FreeString(str);
+        return status;
+      }
+      break;
+    }
+    case S_DOT: {
+      if (c >= '0' && c <= '9') {
+        PushChar(str, c);
+        state = S_FLOAT_D;
+      } else {
+        FreeString(str);
+        return LEXICAL_ERROR;
+      }
+      break;
+    }
+    case S_FLOAT_D:
+      if (c >= '0' && c <= '9') {
+        PushChar(str, c);
+      } else {
+        if (c == 'e' || c == 'E') {
+            PushChar(str, c);
+            state = S_EXP;
+        } else {
+            UngetChar(c);
+            token->type = T_FLOAT;
+            token->value.real = strtod(str->str, NULL);
+            FreeString(str);
+            return OK;
+        }
+      }
+      break;
+    case S_EXP: {
+      if (c == '+' || c == '-') {
+        PushChar(str, c);
+        state = S_EXPS;
+      } else if (c >= '1' && c <= '9') {
+        PushChar(str, c);
+        state = S_FLOAT_E;
+      } else {
+        FreeString(str);
+        return LEXICAL_ERROR;
+      }
+      break;
+    }
+    case S_EXPS: {
+      if (c >= '1' && c <= '9') {
+        PushChar(str, c);
+        state = S_FLOAT_E;
+      } else {
+        FreeString(str);
+        return LEXICAL_ERROR;
+      }
+      break;
+    }
+    case S_FLOAT_E: {
+      if (c >= '0' && c <= '9') {
+        PushChar(str, c);
+      } else {
+        UngetChar(c);
+        token->type = T_FLOAT;
+        token->value.real = strtod(str->str, NULL);
+        FreeString(str);
+        return OK;
+      }
+      break;
+    }
+    case S_GT:
+      if (c == '=') {
+        token->type = T_GEQ;
+        return OK;
+      } else {
+        UngetChar(c);
+        token->type = T_GT;
+        return OK;
+      }
+    case S_LT:
+      if (c == '=') {
+        token->type = T_LEQ;
+        return OK;
+      } else {
+        UngetChar(c);
+        token->type = T_LT;
+        return OK;
+      }
+    case S_EQ:
+      if (c == '=') {
+        token->type = T_EQ;
+        return OK;
+      } else {
+        UngetChar(c);
+        token->type = T_ASSIGN;
+        return OK;
+      }
+    case S_NEQ:
+      if (c == '=') {
+        token->type = T_NEQ;
+        return OK;
+      } else {
+        UngetChar(c);
+        return LEXICAL_ERROR;
+      }
+    case S_DIV: {
+      if (c == '/') {
+
+        c = NextChar();
+        while (c != '\n' && c != EOF) {
+          c = NextChar();
+        }
+
+        if (c == '\n') {
+          UngetChar(c);
+        }
+        state = S_START;
+        break;
+      } else {
+        UngetChar(c);
+        token->type = T_DIV;
+        return OK;
+      }
+    }
+    case S_STR: {
+      if (c == '\n') {
+        return LEXICAL_ERROR;
+      } else if (c == '"') {
+        token->type = T_STR;
+        token->value.string = str;
+        token->keyword = K_UNKNOWN;
+        return OK;
+      } else if (c == '\\') {
+        int escape_char = GetEscapeSequence();
+        if (escape_char >= 0) {
+          PushChar(str, escape_char);
+        } else {
+          return LEXICAL_ERROR;
+        }
+      } else {
+        PushChar(str, c);
+      }
+      break;
+    }
+
+    case S_MLSTR: {
+      if (c == '\\') {
+        c = NextChar();
+        if (c != '\n') {
+          while (c != EOF && c != '\n') {
+            PushChar(str, c);
+            c = NextChar();
+          }
+        }
+        PushChar(str, '\n');
+      } else {
+        return LEXICAL_ERROR;
+      }
+
+      while (true) {
+        c = NextChar();
+        if (isspace(c)) {
+          continue;
+        } else if (c == '\\') {
+          break;
+        } else {
+          // Last line doesn't end with new line
+          str->str[--str->length] = '\0';
+          UngetChar(c);
+          token->type = T_STR;
+          token->value.string = str;
+          token->keyword = K_UNKNOWN;
+          return OK;
+        }
+      }
+      break;
+    }
+    default:
+      return LEXICAL_ERROR;
+    }
+  } while (c != EOF);
+  return 0;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file switchlex.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Hand-coded switch scanner, reference engine of lexbench
+ */
+
+#ifndef SWITCHLEX_H
+#define SWITCHLEX_H
+
+#include "../scanner.h"
+
+void SwitchLexInit(FILE *f);
+void SwitchLexRewind();
+int SwitchLexGetToken(Token *token);
+void SwitchLexDestroy();
+
+#endif // SWITCHLEX_H
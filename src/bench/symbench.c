@@ -0,0 +1,150 @@
+/**
+ * @file symbench.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Symtable lookup microbenchmark
+ *
+ * Usage: ./symbench [ROUNDS]
+ * Compares lookups per second of Swiss table SymtableFind with former table
+ * of pointers to separately allocated items with linear probing, both filled
+ * to the same load factor, half of lookups are misses
+ */
+
+#include "../atom.h"
+#include "../memory.h"
+#include "../symtable.h"
+#include <time.h>
+
+#define CAPACITY 65536 // Slots of both tables
+#define LOOKUPS 65536  // Lookups of one round
+
+static const double loads[] = {0.5, 0.75, 0.875, 0.94};
+
+/**
+ * @brief Former table: slots are pointers to items, NULL is free slot
+ */
+static symtable_item *old_items[CAPACITY];
+
+/**
+ * @brief Current time in seconds from monotonic clock
+ */
+static double Now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Insertion as it was before Swiss table
+ */
+static void OldAdd(Atom *key) {
+  size_t index = key->hash & (CAPACITY - 1);
+  while (old_items[index] != NULL)
+    index = (index + 1) & (CAPACITY - 1);
+  symtable_item *item = malloc(sizeof(symtable_item));
+  item->data = malloc(sizeof(symtable_item_data));
+  item->key = key;
+  old_items[index] = item;
+}
+
+/**
+ * @brief Lookup as it was before Swiss table
+ */
+static symtable_item_data *OldFind(Atom *key) {
+  size_t index = key->hash & (CAPACITY - 1);
+  while (old_items[index] != NULL) {
+    if (old_items[index]->key == key)
+      return old_items[index]->data;
+    index = (index + 1) & (CAPACITY - 1);
+  }
+  return NULL;
+}
+
+/**
+ * @brief Free items of former table
+ */
+static void OldClear() {
+  for (size_t i = 0; i < CAPACITY; i++) {
+    if (old_items[i] != NULL) {
+      free(old_items[i]->data);
+      free(old_items[i]);
+      old_items[i] = NULL;
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 50;
+  if (rounds <= 0) {
+    fprintf(stderr, "Usage: %s [ROUNDS]\n", argv[0]);
+    return INTERNAL_ERROR;
+  }
+  AllocatorInit();
+  AtomTableInit();
+
+  // Keys of items, then keys that are never added
+  size_t max_items = CAPACITY * loads[sizeof(loads) / sizeof(loads[0]) - 1];
+  Atom **keys = malloc(sizeof(Atom *) * max_items * 2);
+  char name[32];
+  for (size_t i = 0; i < max_items * 2; i++) {
+    snprintf(name, sizeof(name), "%s_%zu", i < max_items ? "id" : "miss", i);
+    keys[i] = AtomInternStr(name);
+  }
+
+  // Swiss table reaches CAPACITY by growing, it would grow only over 0.97
+  SymtableConfigure(SYMTABLE_POW2, 0.97);
+
+  printf("%-6s %16s %16s %8s %14s\n", "load", "old Mlookups/s",
+         "swiss Mlookups/s", "speedup", "groups/lookup");
+  Atom **queries = malloc(sizeof(Atom *) * LOOKUPS);
+  srand(42);
+  for (size_t l = 0; l < sizeof(loads) / sizeof(loads[0]); l++) {
+    size_t items = CAPACITY * loads[l];
+    SymtableInit();
+    SymtableEnterFunction();
+    for (size_t i = 0; i < items; i++) {
+      OldAdd(keys[i]);
+      SymtableAdd(keys[i], ST_VAR_VAR);
+    }
+    for (size_t i = 0; i < LOOKUPS; i++)
+      queries[i] = i % 2 == 0 ? keys[rand() % items]
+                              : keys[max_items + rand() % max_items];
+
+    // Both tables have to find the same items
+    size_t old_found = 0, swiss_found = 0;
+    double start = Now();
+    for (int r = 0; r < rounds; r++) {
+      for (size_t i = 0; i < LOOKUPS; i++)
+        old_found += OldFind(queries[i]) != NULL;
+    }
+    double old_time = Now() - start;
+
+    size_t probes = phase_counters[COUNTER_SYMTABLE_PROBES];
+    start = Now();
+    for (int r = 0; r < rounds; r++) {
+      for (size_t i = 0; i < LOOKUPS; i++)
+        swiss_found += SymtableFind(queries[i]) != NULL;
+    }
+    double swiss_time = Now() - start;
+    probes = phase_counters[COUNTER_SYMTABLE_PROBES] - probes;
+
+    if (old_found != swiss_found) {
+      fprintf(stderr, "Tables differ at load %.3f\n", loads[l]);
+      return INTERNAL_ERROR;
+    }
+    double lookups = (double)LOOKUPS * rounds;
+    printf("%-6.3f %16.2f %16.2f %7.2fx %14.3f\n", loads[l],
+           lookups / old_time / 1e6, lookups / swiss_time / 1e6,
+           old_time / swiss_time, probes / lookups);
+    OldClear();
+    SymtableClear();
+  }
+
+  free(queries);
+  free(keys);
+  AtomTableClear();
+  AllocatorDestroy();
+  return 0;
+}
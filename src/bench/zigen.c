@@ -0,0 +1,314 @@
+/**
+ * @file zigen.c
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Deterministic generator of valid IFJ24 programs for benchmarks
+ *
+ * Usage: ./zigen [OPTION VALUE]... > program.zig
+ * The same options and seed always give the same program.
+ * Every variable is used and modified, every function returns, so program
+ * passes all semantic checks of the compiler
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PARAMS 2 // Parameters of every generated function
+
+/**
+ * @brief Knobs of generated program
+ */
+typedef struct GenOptions {
+  long functions;   /**< Count of functions besides main*/
+  long statements;  /**< Statements of function body*/
+  long depth;       /**< Maximum nesting of if/while*/
+  long expr_length; /**< Operands of expression*/
+  long literal;     /**< Characters of string literal, digits of integer*/
+  long identifiers; /**< Variables of every function*/
+  long seed;        /**< Seed of random generator*/
+} GenOptions;
+
+static GenOptions options = {
+    .functions = 100,
+    .statements = 20,
+    .depth = 3,
+    .expr_length = 4,
+    .literal = 16,
+    .identifiers = 8,
+    .seed = 1,
+};
+
+// State of xorshift64 generator
+static uint64_t rng_state;
+
+// Index of function being generated and count of its temporary constants
+static long current_func;
+static long temp_count;
+
+/**
+ * @brief Next random number, xorshift64 is the same on every platform
+ */
+static uint64_t Random() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return rng_state;
+}
+
+/**
+ * @brief Random number from 0 to n - 1
+ */
+static long RandomBelow(long n) { return n <= 0 ? 0 : (long)(Random() % n); }
+
+/**
+ * @brief Print indentation of given nesting level
+ */
+static void Indent(int level) {
+  for (int i = 0; i < level; i++)
+    fputs("  ", stdout);
+}
+
+/**
+ * @brief Print integer literal, it has at most 9 digits to fit i32
+ */
+static void GenInteger() {
+  long digits = options.literal < 1 ? 1 : (options.literal > 9 ? 9 : options.literal);
+  putchar('1' + RandomBelow(9));
+  for (long i = 1; i < digits; i++)
+    putchar('0' + RandomBelow(10));
+}
+
+/**
+ * @brief Print operand: variable, parameter or integer literal
+ */
+static void GenOperand() {
+  long choice = RandomBelow(4);
+  if (choice == 0)
+    GenInteger();
+  else if (choice == 1)
+    printf("p%ld", RandomBelow(PARAMS));
+  else
+    printf("v%ld", RandomBelow(options.identifiers));
+}
+
+/**
+ * @brief Print i32 expression with expr_length operands
+ */
+static void GenExpr() {
+  static const char *operators[] = {" + ", " - ", " * "};
+  long operands = options.expr_length < 1 ? 1 : options.expr_length;
+  bool paren = false;
+  for (long i = 0; i < operands; i++) {
+    if (i > 0)
+      fputs(operators[RandomBelow(3)], stdout);
+    if (!paren && i + 1 < operands && RandomBelow(4) == 0) {
+      putchar('(');
+      paren = true;
+    }
+    GenOperand();
+    if (paren && RandomBelow(2) == 0) {
+      putchar(')');
+      paren = false;
+    }
+  }
+  if (paren)
+    putchar(')');
+}
+
+/**
+ * @brief Print relational expression for if and while
+ */
+static void GenCondition() {
+  static const char *relations[] = {" < ", " > ", " <= ", " >= ", " == ",
+                                    " != "};
+  GenExpr();
+  fputs(relations[RandomBelow(6)], stdout);
+  GenExpr();
+}
+
+/**
+ * @brief Print output of string literal
+ */
+static void GenWrite() {
+  printf("ifj.write(\"");
+  for (long i = 0; i < options.literal; i++)
+    putchar('a' + RandomBelow(26));
+  printf("\\n\");\n");
+}
+
+static void GenStatements(long count, int level);
+
+/**
+ * @brief Print one statement, if/while only while level is below depth
+ */
+static void GenStatement(int level) {
+  long kinds = level <= options.depth ? 6 : 4;
+  long variable = RandomBelow(options.identifiers);
+  Indent(level);
+  switch (RandomBelow(kinds)) {
+  case 0: // Temporary constant, used right away
+    printf("const t%ld: i32 = ", temp_count);
+    GenExpr();
+    printf(";\n");
+    Indent(level);
+    printf("v%ld = v%ld + t%ld;\n", variable, variable, temp_count++);
+    break;
+  case 1: // Call of previous function
+    if (current_func == 0) {
+      GenWrite();
+      break;
+    }
+    printf("v%ld = fun%ld(", variable, RandomBelow(current_func));
+    for (int i = 0; i < PARAMS; i++) {
+      if (i > 0)
+        fputs(", ", stdout);
+      GenExpr();
+    }
+    printf(");\n");
+    break;
+  case 2:
+    GenWrite();
+    break;
+  case 4:
+    printf("if (");
+    GenCondition();
+    printf(") {\n");
+    GenStatements(1 + RandomBelow(3), level + 1);
+    Indent(level);
+    printf("} else {\n");
+    GenStatements(1 + RandomBelow(3), level + 1);
+    Indent(level);
+    printf("}\n");
+    break;
+  case 5: // Loop ends, its variable only grows
+    printf("while (v%ld < ", variable);
+    GenInteger();
+    printf(") {\n");
+    GenStatements(RandomBelow(3), level + 1);
+    Indent(level + 1);
+    printf("v%ld = v%ld + 1;\n", variable, variable);
+    Indent(level);
+    printf("}\n");
+    break;
+  default:
+    printf("v%ld = ", variable);
+    GenExpr();
+    printf(";\n");
+    break;
+  }
+}
+
+/**
+ * @brief Print count of statements of one body
+ */
+static void GenStatements(long count, int level) {
+  for (long i = 0; i < count; i++)
+    GenStatement(level);
+}
+
+/**
+ * @brief Print function fun<index>, it returns sum of its variables
+ */
+static void GenFunction(long index) {
+  current_func = index;
+  temp_count = 0;
+  printf("pub fn fun%ld(", index);
+  for (int i = 0; i < PARAMS; i++)
+    printf("%sp%d: i32", i > 0 ? ", " : "", i);
+  printf(") i32 {\n");
+
+  // Variables are declared before any statement can use them
+  for (long i = 0; i < options.identifiers; i++) {
+    printf("  var v%ld: i32 = ", i);
+    for (int p = 0; p < PARAMS; p++)
+      printf("p%d + ", p);
+    GenInteger();
+    printf(";\n");
+  }
+  GenStatements(options.statements, 1);
+  for (long i = 0; i < options.identifiers; i++)
+    printf("  v%ld = v%ld + 1;\n", i, i);
+
+  printf("  return ");
+  for (long i = 0; i < options.identifiers; i++)
+    printf("%sv%ld", i > 0 ? " + " : "", i);
+  printf(";\n}\n\n");
+}
+
+/**
+ * @brief Print main, it calls every function
+ */
+static void GenMain() {
+  printf("pub fn main() void {\n");
+  printf("  var s: i32 = 0;\n");
+  for (long i = 0; i < options.functions; i++)
+    printf("  s = fun%ld(s, %ld);\n", i, i);
+  if (options.functions == 0)
+    printf("  s = s + 1;\n");
+  printf("  ifj.write(s);\n");
+  printf("}\n");
+}
+
+/**
+ * @brief Print usage to stderr
+ */
+static void Usage(const char *name) {
+  fprintf(stderr,
+          "Usage: %s [OPTION VALUE]...\n"
+          "  --functions N    functions besides main (%ld)\n"
+          "  --statements N   statements of function body (%ld)\n"
+          "  --depth N        maximum nesting of if/while (%ld)\n"
+          "  --expr-length N  operands of expression (%ld)\n"
+          "  --literal N      length of string and integer literals (%ld)\n"
+          "  --identifiers N  variables of every function (%ld)\n"
+          "  --seed N         seed of random generator (%ld)\n",
+          name, options.functions, options.statements, options.depth,
+          options.expr_length, options.literal, options.identifiers,
+          options.seed);
+}
+
+int main(int argc, char *argv[]) {
+  static const struct {
+    const char *name;
+    long *value;
+  } knobs[] = {
+      {"--functions", &options.functions},
+      {"--statements", &options.statements},
+      {"--depth", &options.depth},
+      {"--expr-length", &options.expr_length},
+      {"--literal", &options.literal},
+      {"--identifiers", &options.identifiers},
+      {"--seed", &options.seed},
+  };
+
+  for (int i = 1; i < argc; i++) {
+    size_t k = 0;
+    while (k < sizeof(knobs) / sizeof(knobs[0]) &&
+           strcmp(argv[i], knobs[k].name) != 0)
+      k++;
+    char *end;
+    if (k == sizeof(knobs) / sizeof(knobs[0]) || i + 1 == argc ||
+        (*knobs[k].value = strtol(argv[++i], &end, 10)) < 0 || *end != '\0') {
+      Usage(argv[0]);
+      return 1;
+    }
+  }
+
+  // Expressions need at least one variable
+  if (options.identifiers == 0)
+    options.identifiers = 1;
+
+  // Zero state would stay zero forever
+  rng_state = (uint64_t)options.seed * 0x9E3779B97F4A7C15ull + 1;
+  printf("// Generated by zigen\n");
+  printf("const ifj = @import(\"ifj24.zig\");\n\n");
+  for (long i = 0; i < options.functions; i++)
+    GenFunction(i);
+  GenMain();
+  return 0;
+}
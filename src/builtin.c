@@ -0,0 +1,121 @@
+/**
+ * @file builtin.c
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Functions of ifj module
+ *
+ * Parser resolves name of ifj function to Builtin once, then arguments
+ * are checked by this table and code generator switches on Builtin
+ */
+
+#include "builtin.h"
+
+#define BUILTIN_ENTRY(builtin, name, arity, result, ...)                       \
+  [builtin] = {name, "ifj." name, arity, {__VA_ARGS__}, result}
+
+static const BuiltinInfo builtin_table[BUILTIN_COUNT] = {
+    BUILTIN_ENTRY(BUILTIN_WRITE, "write", 1, ST_VOID, ST_VOID),
+    BUILTIN_ENTRY(BUILTIN_READSTR, "readstr", 0, ST_NULLU8),
+    BUILTIN_ENTRY(BUILTIN_READI32, "readi32", 0, ST_NULLI32),
+    BUILTIN_ENTRY(BUILTIN_READF64, "readf64", 0, ST_NULLF64),
+    BUILTIN_ENTRY(BUILTIN_I2F, "i2f", 1, ST_F64, ST_I32),
+    BUILTIN_ENTRY(BUILTIN_F2I, "f2i", 1, ST_I32, ST_F64),
+    BUILTIN_ENTRY(BUILTIN_STRING, "string", 1, ST_U8, ST_STRING),
+    BUILTIN_ENTRY(BUILTIN_LENGTH, "length", 1, ST_I32, ST_U8),
+    BUILTIN_ENTRY(BUILTIN_CONCAT, "concat", 2, ST_U8, ST_U8, ST_U8),
+    BUILTIN_ENTRY(BUILTIN_SUBSTRING, "substring", 3, ST_NULLU8, ST_U8, ST_I32,
+                  ST_I32),
+    BUILTIN_ENTRY(BUILTIN_STRCMP, "strcmp", 2, ST_I32, ST_U8, ST_U8),
+    BUILTIN_ENTRY(BUILTIN_ORD, "ord", 2, ST_I32, ST_U8, ST_I32),
+    BUILTIN_ENTRY(BUILTIN_CHR, "chr", 1, ST_U8, ST_I32),
+};
+
+#define BUILTIN_MIN_LENGTH 3
+#define BUILTIN_MAX_LENGTH 9
+#define BUILTIN_SLOTS 32 // Must be power of 2
+
+// Slot of name, coefficients are found so no two names collide. Last char
+// can't be used, "readstr" and "readi32" differ there by 64
+#define BUILTIN_SLOT(length, first, penultimate)                               \
+  (((length) + (unsigned char)(first) + 3 * (unsigned char)(penultimate)) &    \
+   (BUILTIN_SLOTS - 1))
+
+typedef struct BuiltinSlot {
+  const char *name;
+  size_t length;
+  Builtin builtin;
+} BuiltinSlot;
+
+// Collision of two names is reported by compiler as overridden initializer
+#define BUILTIN_SLOT_ENTRY(name, first, penultimate, builtin)                  \
+  [BUILTIN_SLOT(sizeof(name) - 1, first, penultimate)] = {                     \
+      name, sizeof(name) - 1, builtin}
+
+static const BuiltinSlot builtin_slots[BUILTIN_SLOTS] = {
+    BUILTIN_SLOT_ENTRY("write", 'w', 't', BUILTIN_WRITE),
+    BUILTIN_SLOT_ENTRY("readstr", 'r', 't', BUILTIN_READSTR),
+    BUILTIN_SLOT_ENTRY("readi32", 'r', '3', BUILTIN_READI32),
+    BUILTIN_SLOT_ENTRY("readf64", 'r', '6', BUILTIN_READF64),
+    BUILTIN_SLOT_ENTRY("i2f", 'i', '2', BUILTIN_I2F),
+    BUILTIN_SLOT_ENTRY("f2i", 'f', '2', BUILTIN_F2I),
+    BUILTIN_SLOT_ENTRY("string", 's', 'n', BUILTIN_STRING),
+    BUILTIN_SLOT_ENTRY("length", 'l', 't', BUILTIN_LENGTH),
+    BUILTIN_SLOT_ENTRY("concat", 'c', 'a', BUILTIN_CONCAT),
+    BUILTIN_SLOT_ENTRY("substring", 's', 'n', BUILTIN_SUBSTRING),
+    BUILTIN_SLOT_ENTRY("strcmp", 's', 'm', BUILTIN_STRCMP),
+    BUILTIN_SLOT_ENTRY("ord", 'o', 'r', BUILTIN_ORD),
+    BUILTIN_SLOT_ENTRY("chr", 'c', 'h', BUILTIN_CHR),
+};
+
+// Atoms of full names, interned at first call in current compilation
+static Atom *builtin_atoms[BUILTIN_COUNT];
+
+/**
+ * @brief Find ifj function by name, name is compared with at most one entry
+ *
+ * @param name Name after ifj. prefix
+ * @param length Length of name
+ *
+ * @return Builtin or BUILTIN_NONE if there is no such function
+ */
+Builtin BuiltinLookup(const char *name, size_t length) {
+  if (length < BUILTIN_MIN_LENGTH || length > BUILTIN_MAX_LENGTH)
+    return BUILTIN_NONE;
+  const BuiltinSlot *slot =
+      &builtin_slots[BUILTIN_SLOT(length, name[0], name[length - 2])];
+  if (slot->length == length && memcmp(slot->name, name, length) == 0)
+    return slot->builtin;
+  return BUILTIN_NONE;
+}
+
+/**
+ * @brief Forget atoms of full names, atom table of previous compilation
+ * is released
+ */
+void BuiltinAtomsReset() { memset(builtin_atoms, 0, sizeof(builtin_atoms)); }
+
+/**
+ * @brief Atom of name with ifj. prefix, it's interned only once
+ *
+ * @param builtin Function other than BUILTIN_NONE
+ *
+ * @return Interned full name
+ */
+Atom *BuiltinAtom(Builtin builtin) {
+  if (builtin_atoms[builtin] == NULL)
+    builtin_atoms[builtin] = AtomInternStr(builtin_table[builtin].full_name);
+  return builtin_atoms[builtin];
+}
+
+/**
+ * @brief Signature of ifj function
+ *
+ * @param builtin Function other than BUILTIN_NONE
+ *
+ * @return Entry of table
+ */
+const BuiltinInfo *BuiltinGetInfo(Builtin builtin) {
+  return &builtin_table[builtin];
+}
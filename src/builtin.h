@@ -0,0 +1,55 @@
+/**
+ * @file builtin.h
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Functions of ifj module header file
+ */
+
+#ifndef BUILTIN_H
+#define BUILTIN_H
+
+#include "symtable.h"
+#include <stddef.h>
+#include <string.h>
+
+#define BUILTIN_PARAMS_MAX 3 // Most parameters of ifj function
+
+typedef enum Builtin {
+  BUILTIN_NONE = -1, // Function declared in program
+  BUILTIN_WRITE = 0,
+  BUILTIN_READSTR,
+  BUILTIN_READI32,
+  BUILTIN_READF64,
+  BUILTIN_I2F,
+  BUILTIN_F2I,
+  BUILTIN_STRING,
+  BUILTIN_LENGTH,
+  BUILTIN_CONCAT,
+  BUILTIN_SUBSTRING,
+  BUILTIN_STRCMP,
+  BUILTIN_ORD,
+  BUILTIN_CHR,
+  BUILTIN_COUNT
+} Builtin;
+
+/**
+ * @brief Signature of ifj function
+ * Parameter of type ST_VOID takes term of any type but void,
+ * parameter of type ST_STRING takes string literal or []u8
+ */
+typedef struct BuiltinInfo {
+  const char *name;                    /**< Name without ifj. prefix*/
+  const char *full_name;               /**< Name with ifj. prefix*/
+  int arity;                           /**< Count of parameters*/
+  DataType params[BUILTIN_PARAMS_MAX]; /**< Types of parameters*/
+  DataType result;                     /**< Return type*/
+} BuiltinInfo;
+
+Builtin BuiltinLookup(const char *name, size_t length);
+const BuiltinInfo *BuiltinGetInfo(Builtin builtin);
+void BuiltinAtomsReset();
+Atom *BuiltinAtom(Builtin builtin);
+
+#endif // BUILTIN_H
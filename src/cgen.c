@@ -12,6 +12,31 @@
 int ifcnt = 1;//global variable that will be used for labels of whiles and ifs unique id 
 stack *index_stack;//stack where will be stored value of if or while that is currently being processed
 
+/**
+ * Print code of one instruction and count it, instruction may be finished
+ * by EmitText when its operand isn't printed by format
+ *
+ * @param format printf format of instruction
+ *
+ * @return
+ */
+static void Emit(const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  vfprintf(stdout, format, args);
+  va_end(args);
+  phase_counters[COUNTER_INSTRUCTIONS]++;
+}
+
+/**
+ * Print text that isn't an instruction (empty line or rest of instruction)
+ *
+ * @param text Text printed as is
+ *
+ * @return
+ */
+static void EmitText(const char *text) { fputs(text, stdout); }
+
 /**
  * Creating header and all needed for further code creation and proceeding of all functions
  *
@@ -20,23 +45,30 @@ stack *index_stack;//stack where will be stored value of if or while that is cur
  * @return
  */
 void CgenStart(ASTStart *code) {
-  fprintf(stdout, ".IFJcode24\n");//header of a file that's needed for interpret 
-  fprintf(stdout,
-          "DEFVAR GF@lefttrue\nDEFVAR GF@righttrue\nDEFVAR GF@inputread\n");//auxiliary variables for logic Expr. and for ifj.read
-  fprintf(stdout, "DEFVAR GF@str1\nDEFVAR GF@str2\n");//auxiliary variables for 2 strings in function 
-  fprintf(stdout, "DEFVAR GF@cnt\nDEFVAR GF@length1\nDEFVAR GF@length2\n");//auxiliary variables for length and some counter 
-  fprintf(stdout, "DEFVAR GF@notnullable\n");//auxiliary variable for | | parts of code
-  fprintf(stdout, "DEFVAR GF@sym1\nDEFVAR GF@sym2\n");//auxiliary variables for symbols
-  fprintf(stdout, "DEFVAR GF@$iftrue\nDEFVAR GF@%%retval\n");//auxiliary variables for logic part and return value 
-  fprintf(stdout, "CALL $$main\n");//so we won't be dependent of order of functions 
-  fprintf(stdout, "EXIT int@0 \n\n");//end of whole code will always be here(in right confitions) 
+  Emit(".IFJcode24\n");//header of a file that's needed for interpret 
+  Emit("DEFVAR GF@lefttrue\n");//auxiliary variables for logic Expr. and for ifj.read
+  Emit("DEFVAR GF@righttrue\n");
+  Emit("DEFVAR GF@inputread\n");
+  Emit("DEFVAR GF@str1\n");//auxiliary variables for 2 strings in function 
+  Emit("DEFVAR GF@str2\n");
+  Emit("DEFVAR GF@cnt\n");//auxiliary variables for length and some counter 
+  Emit("DEFVAR GF@length1\n");
+  Emit("DEFVAR GF@length2\n");
+  Emit("DEFVAR GF@notnullable\n");//auxiliary variable for | | parts of code
+  Emit("DEFVAR GF@sym1\n");//auxiliary variables for symbols
+  Emit("DEFVAR GF@sym2\n");
+  Emit("DEFVAR GF@$iftrue\n");//auxiliary variables for logic part and return value 
+  Emit("DEFVAR GF@%%retval\n");
+  Emit("CALL $$main\n");//so we won't be dependent of order of functions 
+  Emit("EXIT int@0 \n");//end of whole code will always be here(in right confitions) 
+  EmitText("\n");
   index_stack = InvokeAlloc(sizeof(stack));
   InitStack(index_stack);
   ASTFuncDecl *func = code->funcdecls;
   while (func != NULL) {//functions well be in linked list, so we need to proceed them all 
     CgenFuncDecl(func);
     func = func->next;
-    fprintf(stdout, "\n");//tabulation for better readability 
+    EmitText("\n");//tabulation for better readability 
   }
   InvokeFree(index_stack);
 }
@@ -51,8 +83,8 @@ void CgenStart(ASTStart *code) {
 void CgenParam(ASTParam *param) {
   int param_counter = 1;
   while (param != NULL) {//unlike all variables that will be used in function, here we know their value, and it will be const. 
-    fprintf(stdout, "DEFVAR LF@%s\n", param->name);
-    fprintf(stdout, "MOVE LF@%s LF@%%%i\n", param->name, param_counter);
+    Emit("DEFVAR LF@%s\n", param->name->str);
+    Emit("MOVE LF@%s LF@%%%i\n", param->name->str, param_counter);
     param_counter++;
     param = param->next;
   }
@@ -66,25 +98,29 @@ void CgenParam(ASTParam *param) {
  * @return
  */
 void CgenFuncDecl(ASTFuncDecl *func) {
-  fprintf(stdout, "LABEL $$%s\n", func->name);
-  if (!strcmp(func->name, "main")) {//only if it's main we need to create a frame
-    fprintf(stdout, "CREATEFRAME\n");// otherwise it will be created when function is called 
+  TraceSetFunction(func->name->str);
+  double trace_start = TraceStart();
+  Emit("LABEL $$%s\n", func->name->str);
+  if (!strcmp(func->name->str, "main")) {//only if it's main we need to create a frame
+    Emit("CREATEFRAME\n");// otherwise it will be created when function is called 
   }
-  fprintf(stdout, "PUSHFRAME\n");//so work will be in local frame 
-  if (strcmp(func->name, "main")) {
-    fprintf(stdout, "MOVE GF@%%retval nil@nil\n");//sth like inicialization, to prevent errors 
+  Emit("PUSHFRAME\n");//so work will be in local frame 
+  if (strcmp(func->name->str, "main")) {
+    Emit("MOVE GF@%%retval nil@nil\n");//sth like inicialization, to prevent errors 
   }
   CgenParam(func->params);
   if (func->variables != NULL) {//proceeding of all variables that will be used in this function 
     for (size_t i = 0; i < func->variables->size; i++) {
-      fprintf(stdout, "DEFVAR LF@%s\n", (char *)func->variables->array[i]);
+      Emit("DEFVAR LF@%s\n", ((Atom *)func->variables->array[i])->str);
     }
   }
   if(func->body != NULL){//if there is a body, we need to proceed it 
     CgenBody(func->body);
   }
-  fprintf(stdout, "POPFRAME\n"); 
-  fprintf(stdout, "RETURN\n"); 
+  Emit("POPFRAME\n"); 
+  Emit("RETURN\n"); 
+  TraceSpan("CgenFuncDecl", trace_start, func->first_token, func->last_token);
+  TraceSetFunction(NULL);
 }
 
 /**
@@ -101,52 +137,52 @@ void CgenExpr(ASTExpression *expr, bool callfromfunc) {//we use postfix notation
     switch (item->type) {
     case (O_MUL)://both mul and div are in the same place 
       if (item->data.token->type == T_MUL) {
-        fprintf(stdout, "MULS\n");
+        Emit("MULS\n");
       } else if (item->data.token->type == T_DIV) {
-        if(expr->returnType == ST_I32) fprintf(stdout, "IDIVS\n");//I because of int
-        else fprintf(stdout, "DIVS\n");
+        if(expr->returnType == ST_I32) Emit("IDIVS\n");//I because of int
+        else Emit("DIVS\n");
       }
       break;
     case (O_PLUS):
       if (item->data.token->type == T_PLUS) {
-        fprintf(stdout, "ADDS\n");
+        Emit("ADDS\n");
       } else if (item->data.token->type == T_SUB) {
-        fprintf(stdout, "SUBS\n");
+        Emit("SUBS\n");
       }
       break;
     case (O_RELATIONAL):
       if (item->data.token->type == T_LT) {
-        fprintf(stdout, "LTS\n");
-        fprintf(stdout, "PUSHS bool@true\n");
-        fprintf(stdout, "JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
+        Emit("LTS\n");
+        Emit("PUSHS bool@true\n");
+        Emit("JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
       } else if (item->data.token->type == T_GT) {
-        fprintf(stdout, "GTS\n");
-        fprintf(stdout, "PUSHS bool@true\n");
-        fprintf(stdout, "JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
+        Emit("GTS\n");
+        Emit("PUSHS bool@true\n");
+        Emit("JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
       } else if (item->data.token->type == T_EQ) {
-        fprintf(stdout, "EQS\n");
-        fprintf(stdout, "PUSHS bool@true\n");
-        fprintf(stdout, "JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
+        Emit("EQS\n");
+        Emit("PUSHS bool@true\n");
+        Emit("JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
       } else if (item->data.token->type == T_NEQ) {
-        fprintf(stdout, "EQS\n");
-        fprintf(stdout, "PUSHS bool@false\n");
-        fprintf(stdout, "JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
+        Emit("EQS\n");
+        Emit("PUSHS bool@false\n");
+        Emit("JUMPIFNEQS $else%d\n", *(int *)TopStack(index_stack));
       } else if (item->data.token->type == T_LEQ) {//because there is no <= in assembly we do it in parts
-        fprintf(stdout, "POPS GF@righttrue\n");//here we put both sides in auxiliary vars
-        fprintf(stdout, "POPS GF@lefttrue\n");
-        fprintf(stdout, "LT GF@$iftrue GF@lefttrue  GF@righttrue\n");//firstly we check <
-        fprintf(stdout, "JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
-        fprintf(stdout, "EQ GF@$iftrue GF@lefttrue  GF@righttrue\n");//if it's not <, it still can be =
-        fprintf(stdout, "JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
-        fprintf(stdout, "JUMP $else%d\n", *(int *)TopStack(index_stack));//if it's > we do else
+        Emit("POPS GF@righttrue\n");//here we put both sides in auxiliary vars
+        Emit("POPS GF@lefttrue\n");
+        Emit("LT GF@$iftrue GF@lefttrue  GF@righttrue\n");//firstly we check <
+        Emit("JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
+        Emit("EQ GF@$iftrue GF@lefttrue  GF@righttrue\n");//if it's not <, it still can be =
+        Emit("JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
+        Emit("JUMP $else%d\n", *(int *)TopStack(index_stack));//if it's > we do else
       } else if (item->data.token->type == T_GEQ) {//same principle here
-        fprintf(stdout, "POPS GF@righttrue\n");
-        fprintf(stdout, "POPS GF@lefttrue\n");
-        fprintf(stdout, "GT GF@$iftrue GF@lefttrue  GF@righttrue\n");
-        fprintf(stdout, "JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
-        fprintf(stdout, "EQ GF@$iftrue GF@lefttrue  GF@righttrue\n");
-        fprintf(stdout, "JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
-        fprintf(stdout, "JUMP $else%d\n", *(int *)TopStack(index_stack));
+        Emit("POPS GF@righttrue\n");
+        Emit("POPS GF@lefttrue\n");
+        Emit("GT GF@$iftrue GF@lefttrue  GF@righttrue\n");
+        Emit("JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
+        Emit("EQ GF@$iftrue GF@lefttrue  GF@righttrue\n");
+        Emit("JUMPIFEQ $if%i GF@$iftrue bool@true\n",*(int *)TopStack(index_stack));
+        Emit("JUMP $else%d\n", *(int *)TopStack(index_stack));
       }
       break;
     case (O_ID):
@@ -154,21 +190,23 @@ void CgenExpr(ASTExpression *expr, bool callfromfunc) {//we use postfix notation
         CgenFuncCall(item->data.funcCall, true, callfromfunc);
       } else if (!item->isFunction) {
         if (item->data.token->keyword == K_NULL) {
-          fprintf(stdout, "PUSHS nil@nil\n");
+          Emit("PUSHS nil@nil\n");
         } else if (item->data.token->type == T_INT) {
-          fprintf(stdout, "PUSHS int@%i\n", item->data.token->value.integer);
+          Emit("PUSHS int@%i\n", item->data.token->value.integer);
           if(item->i2f){//if Expr have some f64 and int we need to change int to f64
-            fprintf(stdout, "INT2FLOATS\n");
+            Emit("INT2FLOATS\n");
           }
         } else if (item->data.token->type == T_FLOAT) {
-          fprintf(stdout, "PUSHS float@%a\n", item->data.token->value.real);
+          Emit("PUSHS float@%a\n", item->data.token->value.real);
         } else if (item->data.token->type == T_STR) {
-          fprintf(stdout, "PUSHS string@%s\n",
-                  item->data.token->value.string->str);
+          String *literal = item->data.token->value.string;
+          Emit("PUSHS string@");//literal is encoded right to output
+          EncodeLiteral(stdout, literal->str, literal->length);
+          EmitText("\n");
         } else if (item->data.token->type == T_ID) {//also if var is i64 but Expr is in f64, we need to make it also f64
-          fprintf(stdout, "PUSHS LF@%s\n", item->data.token->value.string->str);
+          Emit("PUSHS LF@%s\n", item->data.token->value.atom->str);
           if(item->i2f){
-            fprintf(stdout, "INT2FLOATS\n");
+            Emit("INT2FLOATS\n");
           }
         }
       }
@@ -191,12 +229,12 @@ void CgenExpr(ASTExpression *expr, bool callfromfunc) {//we use postfix notation
 void CgenReturnStat(ASTReturn *ret) {
   if(ret->expr != NULL){//if it's not a void function, we need to proceed an Expr
     CgenExpr(ret->expr, false);
-    fprintf(stdout, "POPS GF@%%retval\n");
-    fprintf(stdout, "POPFRAME\n");
-    fprintf(stdout, "RETURN\n");
+    Emit("POPS GF@%%retval\n");
+    Emit("POPFRAME\n");
+    Emit("RETURN\n");
   }else {
-    fprintf(stdout, "POPFRAME\n");
-    fprintf(stdout, "RETURN\n");
+    Emit("POPFRAME\n");
+    Emit("RETURN\n");
   }
 }
 
@@ -233,32 +271,32 @@ void CgenBody(ASTBody *body) {
  * @return
  */
 void CgenWhile(ASTWhileStatement *cyklus){
-  int *i = InvokeAlloc(sizeof(int));
+  int *i = ArenaAlloc(ARENA_AST, sizeof(int));
   *i = ifcnt;
   ifcnt++;
   PushStack(index_stack, i);
   if(cyklus->notNullID == NULL){//if it's just while(sth){}
-    fprintf(stdout, "LABEL $while%d\n", *i);
+    Emit("LABEL $while%d\n", *i);
     CgenExpr(cyklus->expr, false);//every time we check here condition
-    fprintf(stdout, "LABEL $if%d\n", *i);
+    Emit("LABEL $if%d\n", *i);
     CgenBody(cyklus->whileBody);
-    fprintf(stdout, "JUMP $while%d\n", *i);
-    fprintf(stdout, "LABEL $else%d\n", *i);
+    Emit("JUMP $while%d\n", *i);
+    Emit("LABEL $else%d\n", *i);
   }
   else{//if it's while(sth)|sth|{}
-    fprintf(stdout, "LABEL $while%d\n", *i);
+    Emit("LABEL $while%d\n", *i);
     CgenExpr(cyklus->expr, false);
-    fprintf(stdout, "POPS GF@notnullable\n");
-    fprintf(stdout, "PUSHS GF@notnullable\n");
-    fprintf(stdout, "PUSHS nil@nil\n");
-    fprintf(stdout, "JUMPIFEQS $else%d\n",*i);
-    if(strcmp(cyklus->notNullID, "_")){//if it's not _ we must move it to the variable
-    	fprintf(stdout, "PUSHS GF@notnullable\n");
-	    fprintf(stdout, "POPS LF@%s\n",cyklus->notNullID);
+    Emit("POPS GF@notnullable\n");
+    Emit("PUSHS GF@notnullable\n");
+    Emit("PUSHS nil@nil\n");
+    Emit("JUMPIFEQS $else%d\n",*i);
+    if(strcmp(cyklus->notNullID->str, "_")){//if it's not _ we must move it to the variable
+    	Emit("PUSHS GF@notnullable\n");
+	    Emit("POPS LF@%s\n",cyklus->notNullID->str);
     }
     CgenBody(cyklus->whileBody);
-    fprintf(stdout, "JUMP $while%d\n", *i);
-    fprintf(stdout, "LABEL $else%d\n", *i);
+    Emit("JUMP $while%d\n", *i);
+    Emit("LABEL $else%d\n", *i);
   }
   PopStack(index_stack);
 }
@@ -271,34 +309,34 @@ void CgenWhile(ASTWhileStatement *cyklus){
  * @return
  */
 void CgenIf(ASTIfStatement *ifelse) {
-  int *i = InvokeAlloc(sizeof(int));//otherwise won't work if we put in stack a ifcnt, we'll have bad value
+  int *i = ArenaAlloc(ARENA_AST, sizeof(int));//otherwise won't work if we put in stack a ifcnt, we'll have bad value
   *i = ifcnt;
   ifcnt++;
   PushStack(index_stack, i);
   if(ifelse->notNullID == NULL){
     CgenExpr(ifelse->expr, false);//here we check condition
-    fprintf(stdout, "LABEL $if%d\n", *i);
+    Emit("LABEL $if%d\n", *i);
     CgenBody(ifelse->ifBody);//here will be body of if
-    fprintf(stdout, "JUMP $skip%d\n", *i);//if body of is ended we don't need to do body of else so we skip it
-    fprintf(stdout, "LABEL $else%d\n", *i);//if condition does not apply, we jump here
+    Emit("JUMP $skip%d\n", *i);//if body of is ended we don't need to do body of else so we skip it
+    Emit("LABEL $else%d\n", *i);//if condition does not apply, we jump here
     CgenBody(ifelse->elseBody);
-    fprintf(stdout, "LABEL $skip%d\n", *i);//<- here is this skip
+    Emit("LABEL $skip%d\n", *i);//<- here is this skip
   }
   else{
     CgenExpr(ifelse->expr, false);
-    fprintf(stdout, "POPS GF@notnullable\n");
-    fprintf(stdout, "PUSHS GF@notnullable\n");
-    fprintf(stdout, "PUSHS nil@nil\n");//check for null
-    fprintf(stdout, "JUMPIFEQS $else%d\n",*i);
-    if(strcmp(ifelse->notNullID, "_")){
-    	fprintf(stdout, "PUSHS GF@notnullable\n");
-	    fprintf(stdout, "POPS LF@%s\n",ifelse->notNullID);
+    Emit("POPS GF@notnullable\n");
+    Emit("PUSHS GF@notnullable\n");
+    Emit("PUSHS nil@nil\n");//check for null
+    Emit("JUMPIFEQS $else%d\n",*i);
+    if(strcmp(ifelse->notNullID->str, "_")){
+    	Emit("PUSHS GF@notnullable\n");
+	    Emit("POPS LF@%s\n",ifelse->notNullID->str);
     }
     CgenBody(ifelse->ifBody);
-    fprintf(stdout, "JUMP $skip%d\n", *i);
-    fprintf(stdout, "LABEL $else%d\n", *i);
+    Emit("JUMP $skip%d\n", *i);
+    Emit("LABEL $else%d\n", *i);
     CgenBody(ifelse->elseBody);
-    fprintf(stdout, "LABEL $skip%d\n", *i);
+    Emit("LABEL $skip%d\n", *i);
   }
   PopStack(index_stack);
 }
@@ -315,10 +353,10 @@ void CgenIf(ASTIfStatement *ifelse) {
 void CgenVarDeclDef(ASTVarDeclDef *decloh) {
   CgenExpr(decloh->expr, false);//firstly we need to proceed expr, then assign
   if(decloh->isIgnoring){//if it's _
-    fprintf(stdout, "POPS GF@inputread\n");//it's like just for clearing stack
+    Emit("POPS GF@inputread\n");//it's like just for clearing stack
   }
   else{
-    fprintf(stdout, "POPS LF@%s\n", decloh->name);//otherwise we need to put it in variable, we do it due postfix notation and work in stack primarly
+    Emit("POPS LF@%s\n", decloh->name->str);//otherwise we need to put it in variable, we do it due postfix notation and work in stack primarly
   }
 }
 
@@ -333,154 +371,158 @@ void CgenVarDeclDef(ASTVarDeclDef *decloh) {
  */
 void CgenFuncCall(ASTFuncCall *fcall, bool isdef, bool callfromfunc) {
   ASTParamCall *param = fcall->params;
-  if (!strcmp(fcall->name, "ifj.write")) {
+  // ifj functions are generated inline, others are called
+  switch (fcall->builtin) {
+  case BUILTIN_WRITE:
     CgenExpr(param->expr, true);
-    fprintf(stdout, "POPS GF@inputread\n");
-    fprintf(stdout, "WRITE GF@inputread\n");//inputread is used everywhere as auxiliary variable for all
+    Emit("POPS GF@inputread\n");
+    Emit("WRITE GF@inputread\n");//inputread is used everywhere as auxiliary variable for all
     return;
-  } else if (!strcmp(fcall->name, "ifj.readi32")) {
-    fprintf(stdout, "READ GF@inputread int\n");
-    fprintf(stdout, "PUSHS GF@inputread\n");
+  case BUILTIN_READI32:
+    Emit("READ GF@inputread int\n");
+    Emit("PUSHS GF@inputread\n");
     return;
-  } else if (!strcmp(fcall->name, "ifj.readf64")) { 
-    fprintf(stdout, "READ GF@inputread float\n"); 
-    fprintf(stdout, "PUSHS GF@inputread\n"); 
+  case BUILTIN_READF64:
+    Emit("READ GF@inputread float\n"); 
+    Emit("PUSHS GF@inputread\n"); 
     return; 
-  } else if (!strcmp(fcall->name, "ifj.readstr")) { 
-    fprintf(stdout, "READ GF@inputread string\n"); 
-    fprintf(stdout, "PUSHS GF@inputread\n"); 
+  case BUILTIN_READSTR:
+    Emit("READ GF@inputread string\n"); 
+    Emit("PUSHS GF@inputread\n"); 
     return; 
-  } else if (!strcmp(fcall->name, "ifj.chr")) { 
+  case BUILTIN_CHR:
     CgenExpr(param->expr, true);
-    fprintf(stdout, "POPS GF@cnt\n");
-    fprintf(stdout, "INT2CHAR GF@inputread GF@cnt\n"); 
-    fprintf(stdout, "PUSHS GF@inputread\n"); 
+    Emit("POPS GF@cnt\n");
+    Emit("INT2CHAR GF@inputread GF@cnt\n"); 
+    Emit("PUSHS GF@inputread\n"); 
     return; 
-  } else if (!strcmp(fcall->name, "ifj.ord")) { 
+  case BUILTIN_ORD:
     CgenExpr(param->expr, true);
     CgenExpr(param->next->expr, true);
-    fprintf(stdout, "POPS GF@sym1\n");
-    fprintf(stdout, "POPS GF@cnt\n");
-    fprintf(stdout, "STRLEN GF@sym2 GF@cnt\n");
-    fprintf(stdout, "JUMPIFEQ $$zero%i$$ GF@sym2 int@0\n",ifcnt);
-    fprintf(stdout, "JUMPIFEQ $$zero%i$$ GF@sym2 GF@sym1\n",ifcnt);
-    fprintf(stdout, "LT GF@inputread GF@sym1 int@0\n");
-    fprintf(stdout, "JUMPIFEQ $$zero%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "GT GF@inputread GF@sym1 GF@sym2\n");
-    fprintf(stdout, "JUMPIFEQ $$zero%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "STRI2INT GF@inputread GF@cnt GF@sym1\n");
-    fprintf(stdout, "PUSHS GF@inputread\n");
-    fprintf(stdout, "JUMP $$skip%i$$\n",ifcnt); 
-    fprintf(stdout, "LABEL $$zero%i$$\n",ifcnt);
-    fprintf(stdout, "PUSHS int@0\n");
-    fprintf(stdout, "LABEL $$skip%i$$\n",ifcnt); 
+    Emit("POPS GF@sym1\n");
+    Emit("POPS GF@cnt\n");
+    Emit("STRLEN GF@sym2 GF@cnt\n");
+    Emit("JUMPIFEQ $$zero%i$$ GF@sym2 int@0\n",ifcnt);
+    Emit("JUMPIFEQ $$zero%i$$ GF@sym2 GF@sym1\n",ifcnt);
+    Emit("LT GF@inputread GF@sym1 int@0\n");
+    Emit("JUMPIFEQ $$zero%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("GT GF@inputread GF@sym1 GF@sym2\n");
+    Emit("JUMPIFEQ $$zero%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("STRI2INT GF@inputread GF@cnt GF@sym1\n");
+    Emit("PUSHS GF@inputread\n");
+    Emit("JUMP $$skip%i$$\n",ifcnt); 
+    Emit("LABEL $$zero%i$$\n",ifcnt);
+    Emit("PUSHS int@0\n");
+    Emit("LABEL $$skip%i$$\n",ifcnt); 
     ifcnt++;
     return; 
-  } else if (!strcmp(fcall->name, "ifj.concat")) { 
+  case BUILTIN_CONCAT:
     CgenExpr(param->expr, true);
     CgenExpr(param->next->expr, true);
-    fprintf(stdout, "POPS GF@sym2\n");
-    fprintf(stdout, "POPS GF@sym1\n");
-    fprintf(stdout, "CONCAT GF@inputread GF@sym1 GF@sym2\n");
-    fprintf(stdout, "PUSHS GF@inputread\n"); 
+    Emit("POPS GF@sym2\n");
+    Emit("POPS GF@sym1\n");
+    Emit("CONCAT GF@inputread GF@sym1 GF@sym2\n");
+    Emit("PUSHS GF@inputread\n"); 
     return; 
-  } else if (!strcmp(fcall->name, "ifj.string")) { 
+  case BUILTIN_STRING:
     CgenExpr(param->expr, true);
     return; 
-  } else if (!strcmp(fcall->name, "ifj.length")) { 
+  case BUILTIN_LENGTH:
     CgenExpr(param->expr, true);
-    fprintf(stdout, "POPS GF@sym1\n");
-    fprintf(stdout, "STRLEN GF@inputread GF@sym1\n");
-    fprintf(stdout, "PUSHS GF@inputread\n"); 
+    Emit("POPS GF@sym1\n");
+    Emit("STRLEN GF@inputread GF@sym1\n");
+    Emit("PUSHS GF@inputread\n"); 
     return; 
-  } else if (!strcmp(fcall->name, "ifj.i2f")) { 
+  case BUILTIN_I2F:
     CgenExpr(param->expr, true);
-    fprintf(stdout, "POPS GF@sym1\n");
-    fprintf(stdout, "INT2FLOAT GF@inputread GF@sym1\n");
-    fprintf(stdout, "PUSHS GF@inputread\n");  
+    Emit("POPS GF@sym1\n");
+    Emit("INT2FLOAT GF@inputread GF@sym1\n");
+    Emit("PUSHS GF@inputread\n");  
     return; 
-  } else if (!strcmp(fcall->name, "ifj.f2i")) { 
+  case BUILTIN_F2I:
     CgenExpr(param->expr, true);
-    fprintf(stdout, "POPS GF@sym1\n");
-    fprintf(stdout, "FLOAT2INT GF@inputread GF@sym1\n");
-    fprintf(stdout, "PUSHS GF@inputread\n");  
+    Emit("POPS GF@sym1\n");
+    Emit("FLOAT2INT GF@inputread GF@sym1\n");
+    Emit("PUSHS GF@inputread\n");  
     return; 
-  } else if (!strcmp(fcall->name, "ifj.substring")) { 
+  case BUILTIN_SUBSTRING:
     CgenExpr(param->expr, true);
     CgenExpr(param->next->expr, true); 
     CgenExpr(param->next->next->expr, true);
-    fprintf(stdout, "POPS GF@length2\n");  
-    fprintf(stdout, "POPS GF@cnt\n");  
-    fprintf(stdout, "POPS GF@str1\n"); 
-    fprintf(stdout, "STRLEN GF@length1 GF@str1\n");
-    fprintf(stdout, "LT GF@inputread GF@cnt int@0\n");//check of all bad options, listed in documentation
-    fprintf(stdout, "JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "LT GF@inputread GF@length2 int@0\n");
-    fprintf(stdout, "JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "GT GF@inputread GF@cnt GF@length2\n");
-    fprintf(stdout, "JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "JUMPIFEQ $$empty%i$$ GF@cnt GF@length2\n",ifcnt);
-    fprintf(stdout, "GT GF@inputread GF@length2 GF@length1\n");
-    fprintf(stdout, "JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "GT GF@inputread GF@cnt GF@length1\n");
-    fprintf(stdout, "JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "JUMPIFEQ $$null%i$$ GF@cnt GF@length1\n",ifcnt);
-    fprintf(stdout, "GETCHAR GF@str2 GF@str1 GF@cnt\n");//here we take first symbol, because part in cykle writed by concat, so we need some first char in this
-    fprintf(stdout, "ADD GF@cnt GF@cnt int@1\n"); 
-    fprintf(stdout, "LABEL $$substring%i$$\n",ifcnt);
-    fprintf(stdout, "JUMPIFEQ $$end%i$$ GF@cnt GF@length2\n",ifcnt);//we end if i = j
-    fprintf(stdout, "GETCHAR GF@sym1 GF@str1 GF@cnt\n"); //we get char
-    fprintf(stdout, "CONCAT GF@str2 GF@str2 GF@sym1\n"); //we put it in final string
-    fprintf(stdout, "ADD GF@cnt GF@cnt int@1\n"); 
-    fprintf(stdout, "JUMP  $$substring%i$$\n",ifcnt);
-    fprintf(stdout, "LABEL $$end%i$$\n",ifcnt);
-    fprintf(stdout, "PUSHS GF@str2\n");
-    fprintf(stdout, "JUMP  $$skip%i$$\n",ifcnt);
-    fprintf(stdout, "LABEL $$empty%i$$\n",ifcnt);
-    fprintf(stdout, "PUSHS string@\n");
-    fprintf(stdout, "JUMP  $$skip%i$$\n",ifcnt);
-    fprintf(stdout, "LABEL $$null%i$$\n",ifcnt);
-    fprintf(stdout, "PUSHS nil@nil\n");
-    fprintf(stdout, "LABEL $$skip%i$$\n",ifcnt);
+    Emit("POPS GF@length2\n");  
+    Emit("POPS GF@cnt\n");  
+    Emit("POPS GF@str1\n"); 
+    Emit("STRLEN GF@length1 GF@str1\n");
+    Emit("LT GF@inputread GF@cnt int@0\n");//check of all bad options, listed in documentation
+    Emit("JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("LT GF@inputread GF@length2 int@0\n");
+    Emit("JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("GT GF@inputread GF@cnt GF@length2\n");
+    Emit("JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("JUMPIFEQ $$empty%i$$ GF@cnt GF@length2\n",ifcnt);
+    Emit("GT GF@inputread GF@length2 GF@length1\n");
+    Emit("JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("GT GF@inputread GF@cnt GF@length1\n");
+    Emit("JUMPIFEQ $$null%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("JUMPIFEQ $$null%i$$ GF@cnt GF@length1\n",ifcnt);
+    Emit("GETCHAR GF@str2 GF@str1 GF@cnt\n");//here we take first symbol, because part in cykle writed by concat, so we need some first char in this
+    Emit("ADD GF@cnt GF@cnt int@1\n"); 
+    Emit("LABEL $$substring%i$$\n",ifcnt);
+    Emit("JUMPIFEQ $$end%i$$ GF@cnt GF@length2\n",ifcnt);//we end if i = j
+    Emit("GETCHAR GF@sym1 GF@str1 GF@cnt\n"); //we get char
+    Emit("CONCAT GF@str2 GF@str2 GF@sym1\n"); //we put it in final string
+    Emit("ADD GF@cnt GF@cnt int@1\n"); 
+    Emit("JUMP  $$substring%i$$\n",ifcnt);
+    Emit("LABEL $$end%i$$\n",ifcnt);
+    Emit("PUSHS GF@str2\n");
+    Emit("JUMP  $$skip%i$$\n",ifcnt);
+    Emit("LABEL $$empty%i$$\n",ifcnt);
+    Emit("PUSHS string@\n");
+    Emit("JUMP  $$skip%i$$\n",ifcnt);
+    Emit("LABEL $$null%i$$\n",ifcnt);
+    Emit("PUSHS nil@nil\n");
+    Emit("LABEL $$skip%i$$\n",ifcnt);
     ifcnt++;
     return; 
-  } else if (!strcmp(fcall->name, "ifj.strcmp")) { 
+  case BUILTIN_STRCMP:
     CgenExpr(param->expr, true);
     CgenExpr(param->next->expr, true);
-    fprintf(stdout, "POPS GF@str2\n");
-    fprintf(stdout, "POPS GF@str1\n");
-    fprintf(stdout, "LT GF@inputread GF@str1 GF@str2\n");//here we check all possibilities 
-    fprintf(stdout, "JUMPIFEQ $$minus%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "EQ GF@inputread GF@str1 GF@str2\n");//step by step
-    fprintf(stdout, "JUMPIFEQ $$zero%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "GT GF@inputread GF@str1 GF@str2\n");
-    fprintf(stdout, "JUMPIFEQ $$plus%i$$ GF@inputread bool@true\n",ifcnt);
-    fprintf(stdout, "LABEL $$minus%i$$\n",ifcnt);//there is all labels with respectively options
-    fprintf(stdout, "PUSHS int@-1\n");
-    fprintf(stdout, "JUMP  $$skip%i$$\n",ifcnt);//return value is the same as in a C strcmp
-    fprintf(stdout, "LABEL $$plus%i$$\n",ifcnt);
-    fprintf(stdout, "PUSHS int@1\n");
-    fprintf(stdout, "JUMP  $$skip%i$$\n",ifcnt);
-    fprintf(stdout, "LABEL $$zero%i$$\n",ifcnt);
-    fprintf(stdout, "PUSHS int@0\n");
-    fprintf(stdout, "LABEL $$skip%i$$\n",ifcnt);
+    Emit("POPS GF@str2\n");
+    Emit("POPS GF@str1\n");
+    Emit("LT GF@inputread GF@str1 GF@str2\n");//here we check all possibilities 
+    Emit("JUMPIFEQ $$minus%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("EQ GF@inputread GF@str1 GF@str2\n");//step by step
+    Emit("JUMPIFEQ $$zero%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("GT GF@inputread GF@str1 GF@str2\n");
+    Emit("JUMPIFEQ $$plus%i$$ GF@inputread bool@true\n",ifcnt);
+    Emit("LABEL $$minus%i$$\n",ifcnt);//there is all labels with respectively options
+    Emit("PUSHS int@-1\n");
+    Emit("JUMP  $$skip%i$$\n",ifcnt);//return value is the same as in a C strcmp
+    Emit("LABEL $$plus%i$$\n",ifcnt);
+    Emit("PUSHS int@1\n");
+    Emit("JUMP  $$skip%i$$\n",ifcnt);
+    Emit("LABEL $$zero%i$$\n",ifcnt);
+    Emit("PUSHS int@0\n");
+    Emit("LABEL $$skip%i$$\n",ifcnt);
     ifcnt++;
     return; 
+  default:
+    break;
   }
-  if(callfromfunc)fprintf(stdout, "PUSHFRAME\n");//part of funexp extension
-  fprintf(stdout, "CREATEFRAME\n");//temp frame for transmission a vars
+  if(callfromfunc)Emit("PUSHFRAME\n");//part of funexp extension
+  Emit("CREATEFRAME\n");//temp frame for transmission a vars
   int param_counter = 1;
   while (param != NULL) {//when we call we need to put variables to temp frame so we'll be able to use it in function that is written somewhere below
-    fprintf(stdout, "DEFVAR TF@%%%d\n", param_counter);
+    Emit("DEFVAR TF@%%%d\n", param_counter);
     CgenExpr(param->expr, true);
-    fprintf(stdout, "POPS TF@%%%d\n", param_counter);
-    fprintf(stdout,"\n");
+    Emit("POPS TF@%%%d\n", param_counter);
+    EmitText("\n");
     param_counter++;
     param = param->next;
   }
-  fprintf(stdout, "CALL $$%s\n", fcall->name);
+  Emit("CALL $$%s\n", fcall->name->str);
   if (isdef) {
-    fprintf(stdout, "PUSHS GF@%%retval\n");//if this is var = func, we need to push return value so it can be assigned to var
+    Emit("PUSHS GF@%%retval\n");//if this is var = func, we need to push return value so it can be assigned to var
   }
-  if(callfromfunc)fprintf(stdout, "POPFRAME\n");
+  if(callfromfunc)Emit("POPFRAME\n");
 }
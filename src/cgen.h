@@ -11,11 +11,13 @@
 #define CGEN_H
 
 #include "ASTnodes.h"
+#include "encoder.h"
 #include "error.h"
 #include "expr_parser.h"
 #include "memory.h"
 #include "scanner.h"
 #include "stack.h"
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -0,0 +1,68 @@
+/**
+ * @file encoder.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief IFJcode24 string literal encoder
+ *
+ * Whitespace, control chars, # and backslash are written as \ddd.
+ * Runs of other chars are found by scan_run.literal kernel and copied
+ * at once, only escaped chars are handled one by one
+ */
+
+#include "encoder.h"
+
+// IFJcode24 escape sequence \ddd of character
+#define ESC(c) {'\\', '0' + (c) / 100, '0' + (c) / 10 % 10, '0' + (c) % 10}
+#define ESC4(c) ESC(c), ESC(c + 1), ESC(c + 2), ESC(c + 3)
+#define ESC16(c) ESC4(c), ESC4(c + 4), ESC4(c + 8), ESC4(c + 12)
+
+#define ESC_LENGTH 4 // Length of \ddd
+
+/**
+ * Escape sequence of chars 0-47, only chars up to # and \ are escaped
+ */
+static const char escape_code[48][ESC_LENGTH] = {ESC16(0), ESC16(16),
+                                                 ESC16(32)};
+static const char escape_backslash[ESC_LENGTH] = ESC('\\');
+
+#define ENCODE_BUFFER 4096
+
+/**
+ * @brief Write string value as IFJcode24 literal (part after string@)
+ *
+ * @param out Output file
+ * @param s Value of literal, can contain null char
+ * @param length Length of value
+ */
+void EncodeLiteral(FILE *out, const char *s, size_t length) {
+  const unsigned char *data = (const unsigned char *)s;
+  char buffer[ENCODE_BUFFER];
+  size_t used = 0;
+  size_t i = 0;
+  while (i < length) {
+    size_t run = scan_run.literal(data + i, length - i);
+    // Long runs go straight to output
+    if (run > ENCODE_BUFFER - used) {
+      fwrite(buffer, 1, used, out);
+      fwrite(data + i, 1, run, out);
+      used = 0;
+    } else {
+      memcpy(buffer + used, data + i, run);
+      used += run;
+    }
+    if ((i += run) == length)
+      break;
+
+    if (used + ESC_LENGTH > ENCODE_BUFFER) {
+      fwrite(buffer, 1, used, out);
+      used = 0;
+    }
+    unsigned char c = data[i++];
+    memcpy(buffer + used, c == '\\' ? escape_backslash : escape_code[c],
+           ESC_LENGTH);
+    used += ESC_LENGTH;
+  }
+  fwrite(buffer, 1, used, out);
+}
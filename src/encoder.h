@@ -0,0 +1,20 @@
+/**
+ * @file encoder.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief IFJcode24 string literal encoder header file
+ */
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include "scanrun.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+void EncodeLiteral(FILE *out, const char *s, size_t length);
+
+#endif // ENCODER_H
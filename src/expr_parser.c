@@ -13,6 +13,9 @@
 Token expr_token;
 bool isknown_return;
 
+// Pools of expression items and copied tokens
+Pool expr_pool = POOL_INIT("Expr", Expr);
+
 const char precedence_lookup[7][7] = {
             /*m    a    id   rel  (    )    $ */
   /*mul */ {'>', '>', '<', '>', '<', '>', '>'},
@@ -28,7 +31,7 @@ const char precedence_lookup[7][7] = {
  * @brief Get next token from token array
  */
 void GetNextTokenExpr() {
-  expr_token = *scanner->tokens[scanner->current_token];
+  ScannerGetToken(scanner->current_token, &expr_token);
   scanner->current_token++;
 }
 
@@ -62,7 +65,7 @@ void MakeTopTerminalLess(stack *pushdown) {
  * @return copied token
  */
 Token* CopyToken() {
-  Token* copy_token = InvokeAlloc(sizeof(Token));
+  Token* copy_token = PoolAlloc(&token_pool);
   copy_token->keyword = expr_token.keyword;
   copy_token->type = expr_token.type;
   copy_token->value = expr_token.value;
@@ -136,8 +139,9 @@ precedenceType GetType(bool additional_parenthesis, int *count_parentheses, bool
  * @return new Expr item
  */
 Expr *CreateExprItem(bool additional_parenthesis, int *count_parentheses, bool additional_comma) {
-  Expr* expression = InvokeAlloc(sizeof(Expr));
-  Expr_data *item = InvokeAlloc(sizeof(Expr_data));
+  // Expr is needed only while parsing, Expr_data goes to AST
+  Expr* expression = PoolAlloc(&expr_pool);
+  Expr_data *item = ArenaAlloc(ARENA_AST, sizeof(Expr_data));
 
   expression->isLess = false;
   expression->isTerminal = true;
@@ -157,8 +161,7 @@ Expr *CreateExprItem(bool additional_parenthesis, int *count_parentheses, bool a
       GetNextTokenExpr();
       if (expr_token.type == T_OPAREN || expr_token.type == T_DOT) {
         item->isFunction = true;
-        item->data.funcCall = InvokeAlloc(sizeof(ASTFuncCall));
-        item->data.funcCall->params = NULL;
+        item->data.funcCall = CreateASTFuncCall();
         expression->returnType = ParseFuncCall(item->data.funcCall);
       } else {
         scanner->current_token -= 2;
@@ -166,7 +169,7 @@ Expr *CreateExprItem(bool additional_parenthesis, int *count_parentheses, bool a
         item->isFunction = false;
         if(expr_token.keyword != K_UNKNOWN) InvokeExit(SYNTAX_ERROR);
         item->data.token = CopyToken();
-        symtable_item_data *var = SymtableUpdate_isUsed(expr_token.value.string->str);
+        symtable_item_data *var = SymtableUpdate_isUsed(expr_token.value.atom);
         expression->isKnownConstant = var->details.var.isKnown;
         expression->returnType = var->details.var.type;
       }
@@ -243,7 +246,11 @@ void Reduce(stack* pushdown, stack* postfix) {
   else if(until_less == 2) {
     op->isTerminal = false;
     //(E)->E
-    if(lhs->item->type == O_OPENPAREN && rhs->item->type == O_CLOSEPAREN) {}
+    if(lhs->item->type == O_OPENPAREN && rhs->item->type == O_CLOSEPAREN) {
+      //Parentheses won't be in postfix notation
+      PoolFree(&expr_pool, lhs);
+      PoolFree(&expr_pool, rhs);
+    }
 
     // (i == i) == i->SYNTAX ERROR
     else if((lhs->returnType ==ST_BOOL || rhs->returnType ==ST_BOOL) && op->item->type == O_RELATIONAL) InvokeExit(SYNTAX_ERROR);
@@ -319,8 +326,13 @@ void Reduce(stack* pushdown, stack* postfix) {
 DataType PrecedeneParseExpression(stack **output_stack, bool parenthesis, bool comma) {
   DataType return_type;
   int count_parentheses = 0;
-  stack *pushdown = InvokeAlloc(sizeof(stack));
-  stack *postfix = InvokeAlloc(sizeof(stack));
+  //Everything from scratch arena will be freed at the end of this expression
+  //Nested expressions (function call parameters) rewind only their own part
+  ArenaMark scratch = ArenaGetMark(ARENA_EXPR);
+  double trace_start = TraceStart();
+  size_t first_token = scanner->current_token;
+  stack *pushdown = ArenaAlloc(ARENA_EXPR, sizeof(stack));
+  stack *postfix = ArenaAlloc(ARENA_EXPR, sizeof(stack));
 
   isknown_return = true;
   bool expr_has_f64 = false;
@@ -329,8 +341,8 @@ DataType PrecedeneParseExpression(stack **output_stack, bool parenthesis, bool c
   InitStack(pushdown);
 
   //$ on bottom always
-  Expr *left = InvokeAlloc(sizeof(Expr));
-  left->item = InvokeAlloc(sizeof(Expr_data));
+  Expr *left = PoolAlloc(&expr_pool);
+  left->item = ArenaAlloc(ARENA_EXPR, sizeof(Expr_data));
   left->isLess = false;
   left->isTerminal = true;
   left->item->type = O_DOLLAR;
@@ -355,6 +367,8 @@ DataType PrecedeneParseExpression(stack **output_stack, bool parenthesis, bool c
       if(final->item->type != O_DOLLAR){
         isknown_return = final->isKnownConstant;
       }
+      //Only empty expression $ is not in postfix stack
+      else PoolFree(&expr_pool, final);
       break;
     }
 
@@ -389,11 +403,24 @@ DataType PrecedeneParseExpression(stack **output_stack, bool parenthesis, bool c
     else expr_item->item->i2f = false;
     PopStack(postfix);
     PushStack((*output_stack), expr_item->item);
-    InvokeFree(expr_item);
+    PoolFree(&expr_pool, expr_item);
+  }
+
+  //Bottom $ and last $ from input
+  while (!IsEmptyStack(pushdown)) {
+    PoolFree(&expr_pool, TopStack(pushdown));
+    PopStack(pushdown);
   }
+  PoolFree(&expr_pool, right);
 
   FreeStack(postfix);
   FreeStack(pushdown);
+  ArenaRewind(ARENA_EXPR, scratch);
+
+  //Only large expressions are traced, last read token is not part of expression
+  if (scanner->current_token - first_token > TRACE_EXPR_MIN)
+    TraceSpan("PrecedeneParseExpression", trace_start, first_token,
+              scanner->current_token - 2);
 
   return return_type;
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include "ASTnodes.h"
 #include "memory.h"
 #include "parser.h"
+#include "pool.h"
 #include "scanner.h"
 #include "symtable.h"
 #include "stack.h"
@@ -21,6 +22,7 @@
 
 //If expression has only literals or constants
 extern bool isknown_return;
+extern Pool expr_pool;
 
 typedef enum {
   O_MUL = 0,
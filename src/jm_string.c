@@ -11,10 +11,11 @@
 
 /**
  * @brief Allocate new string
+ * Strings belong to tokens, so they live in scanner arena
  */
 String *StringNew(void) {
-  String *string = InvokeAlloc(sizeof(String));
-  string->str = InvokeAlloc(sizeof(char) * 10);
+  String *string = ArenaAlloc(ARENA_SCANNER, sizeof(String));
+  string->str = ArenaAlloc(ARENA_SCANNER, sizeof(char) * 10);
   string->str[0] = '\0';
   string->capacity = 10;
   string->length = 0;
@@ -30,10 +31,11 @@ void PushChar(String *self, char c) {
   // Check if string can be extended
   if (self->length == self->capacity - 1) {
     // Double the capacity if needed or set to 1 if string is empty
+    size_t old_capacity = self->capacity;
     self->capacity = self->capacity == 0 ? 1 : self->capacity * 2;
 
     // Reallocate string for the new capacity
-    self->str = InvokeRealloc(self->str, self->capacity);
+    self->str = ArenaRealloc(ARENA_SCANNER, self->str, old_capacity, self->capacity);
   }
   // Put new char to string
   self->str[self->length++] = c;
@@ -56,14 +58,46 @@ void PushString(String *self, const char *str) {
   }
 }
 
+/**
+ * @brief Push part of other string to string
+ *
+ * @param self String
+ * @param str Start of part, doesn't have to be null terminated
+ * @param length Length of part
+ */
+void PushSlice(String *self, const char *str, size_t length) {
+  memcpy(StringExtend(self, length), str, length);
+}
+
+/**
+ * @brief Make string longer, so caller can write new chars directly
+ *
+ * @param self String
+ * @param length Count of new chars
+ * @return Pointer to the first new char
+ */
+char *StringExtend(String *self, size_t length) {
+  if (self->length + length >= self->capacity) {
+    size_t old_capacity = self->capacity;
+    while (self->length + length >= self->capacity)
+      self->capacity *= 2;
+    self->str = ArenaRealloc(ARENA_SCANNER, self->str, old_capacity, self->capacity);
+  }
+  char *end = self->str + self->length;
+  self->length += length;
+  self->str[self->length] = '\0';
+  return end;
+}
+
 /**
  * @brief Free string
  *
  * @param self String
  */
 void FreeString(String *self) {
-  InvokeFree(self->str);
-  InvokeFree(self);
+  // Memory is reused only if string was the last allocation in arena
+  ArenaFree(ARENA_SCANNER, self->str, self->capacity);
+  ArenaFree(ARENA_SCANNER, self, sizeof(String));
   self = NULL;
 }
 
@@ -10,6 +10,7 @@
 #ifndef JM_STRING_H
 #define JM_STRING_H
 
+#include "arena.h"
 #include "memory.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +25,8 @@ typedef struct _string {
 void FreeString(String *self);
 void PushChar(String *self, char c);
 void PushString(String *self, const char *str);
+void PushSlice(String *self, const char *str, size_t length);
+char *StringExtend(String *self, size_t length);
 String *StringNew(void);
 int StringEquals(String *self, const char *other);
 
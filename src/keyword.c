@@ -0,0 +1,81 @@
+/**
+ * @file keyword.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Keyword recognition by perfect hash
+ *
+ * Length, first and last character of keyword give unique slot,
+ * so identifier is compared with at most one keyword
+ */
+
+#include "keyword.h"
+
+#define KEYWORD_MIN_LENGTH 2
+#define KEYWORD_MAX_LENGTH 6
+#define KEYWORD_SLOTS 32 // Must be power of 2
+
+// Slot of keyword, coefficients are found so no two keywords collide
+#define KEYWORD_SLOT(length, first, last)                                      \
+  (((length) + (unsigned char)(first) + 22 * (unsigned char)(last)) &          \
+   (KEYWORD_SLOTS - 1))
+
+typedef struct KeywordEntry {
+  const char *name;
+  size_t length;
+  Keyword keyword;
+} KeywordEntry;
+
+// Collision of two keywords is reported by compiler as overridden initializer
+#define KEYWORD_ENTRY(name, first, last, keyword)                              \
+  [KEYWORD_SLOT(sizeof(name) - 1, first, last)] = {name, sizeof(name) - 1,     \
+                                                   keyword}
+
+static const KeywordEntry keyword_table[KEYWORD_SLOTS] = {
+    KEYWORD_ENTRY("const", 'c', 't', K_CONST),
+    KEYWORD_ENTRY("else", 'e', 'e', K_ELSE),
+    KEYWORD_ENTRY("fn", 'f', 'n', K_FN),
+    KEYWORD_ENTRY("if", 'i', 'f', K_IF),
+    KEYWORD_ENTRY("i32", 'i', '2', K_I32),
+    KEYWORD_ENTRY("f64", 'f', '4', K_F64),
+    KEYWORD_ENTRY("null", 'n', 'l', K_NULL),
+    KEYWORD_ENTRY("pub", 'p', 'b', K_PUB),
+    KEYWORD_ENTRY("return", 'r', 'n', K_RETURN),
+    KEYWORD_ENTRY("u8", 'u', '8', K_U8),
+    KEYWORD_ENTRY("var", 'v', 'r', K_VAR),
+    KEYWORD_ENTRY("void", 'v', 'd', K_VOID),
+    KEYWORD_ENTRY("while", 'w', 'e', K_WHILE),
+    KEYWORD_ENTRY("ifj", 'i', 'j', K_IFJ),
+};
+
+/**
+ * @brief Get keyword from identifier
+ *
+ * @param str Identifier, doesn't have to be null terminated
+ * @param length Length of identifier
+ * @return Keyword or K_UNKNOWN
+ */
+Keyword KeywordLookup(const char *str, size_t length) {
+  if (length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH)
+    return K_UNKNOWN;
+  const KeywordEntry *entry =
+      &keyword_table[KEYWORD_SLOT(length, str[0], str[length - 1])];
+  if (entry->length == length && memcmp(entry->name, str, length) == 0)
+    return entry->keyword;
+  return K_UNKNOWN;
+}
+
+/**
+ * @brief Get text of keyword
+ *
+ * @param keyword Keyword
+ * @return Keyword as written in code or NULL for K_UNKNOWN
+ */
+const char *KeywordName(Keyword keyword) {
+  for (size_t i = 0; i < KEYWORD_SLOTS; i++) {
+    if (keyword_table[i].name != NULL && keyword_table[i].keyword == keyword)
+      return keyword_table[i].name;
+  }
+  return NULL;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file keyword.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Keyword recognition header file
+ */
+
+#ifndef KEYWORD_H
+#define KEYWORD_H
+
+#include <stddef.h>
+#include <string.h>
+
+typedef enum Keyword {
+  K_UNKNOWN = -1,
+  K_CONST = 0,
+  K_ELSE,
+  K_FN,
+  K_IF,
+  K_I32,
+  K_F64,
+  K_NULL,
+  K_PUB,
+  K_RETURN,
+  K_U8,
+  K_VAR,
+  K_VOID,
+  K_WHILE,
+  K_IFJ,
+  K_COUNT
+} Keyword;
+
+Keyword KeywordLookup(const char *str, size_t length);
+const char *KeywordName(Keyword keyword);
+
+#endif // KEYWORD_H
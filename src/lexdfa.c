@@ -0,0 +1,123 @@
+/**
+ * @file lexdfa.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Transition tables of scanner automaton
+ *
+ * Tables only decide where token ends and what type it has,
+ * value of token (escapes, numbers, keywords) is made by scanner from lexeme
+ */
+
+#include "lexdfa.h"
+
+/**
+ * Character class of every byte, not listed bytes are C_OTHER
+ */
+const unsigned char char_class[256] = {
+    [' '] = C_WS,        ['\t'] = C_WS,       ['\v'] = C_WS,
+    ['\f'] = C_WS,       ['\r'] = C_WS,       ['\n'] = C_NL,
+    [';'] = C_SINGLE,    [':'] = C_SINGLE,    [','] = C_SINGLE,
+    ['('] = C_SINGLE,    [')'] = C_SINGLE,    ['['] = C_SINGLE,
+    [']'] = C_SINGLE,    ['{'] = C_SINGLE,    ['}'] = C_SINGLE,
+    ['|'] = C_SINGLE,    ['@'] = C_SINGLE,    ['?'] = C_SINGLE,
+    ['*'] = C_SINGLE,    ['.'] = C_DOT,       ['+'] = C_PLUS,
+    ['-'] = C_MINUS,     ['<'] = C_LT,        ['>'] = C_GT,
+    ['='] = C_EQ,        ['!'] = C_BANG,      ['/'] = C_SLASH,
+    ['"'] = C_QUOTE,     ['\\'] = C_BACKSLASH, ['0'] = C_ZERO,
+    ['1' ... '9'] = C_DIGIT,
+    ['e'] = C_E,         ['E'] = C_E,
+    ['a' ... 'd'] = C_LETTER, ['f' ... 'z'] = C_LETTER,
+    ['A' ... 'D'] = C_LETTER, ['F' ... 'Z'] = C_LETTER,
+    ['_'] = C_UNDERSCORE,
+};
+
+/**
+ * Token type of one character tokens
+ */
+const unsigned char single_token[256] = {
+    ['.'] = T_DOT,     [';'] = T_SEMICOLON, [':'] = T_COLON,
+    [','] = T_COMMA,   ['('] = T_OPAREN,    [')'] = T_CPAREN,
+    ['['] = T_OSQUARE, [']'] = T_CSQUARE,   ['{'] = T_OCURLY,
+    ['}'] = T_CCURLY,  ['|'] = T_PIPE,      ['@'] = T_AT,
+    ['?'] = T_QUESTM,  ['+'] = T_PLUS,      ['-'] = T_SUB,
+    ['*'] = T_MUL,
+};
+
+// All classes of real characters except new line, quote and backslash
+#define TEXT_CLASSES(S)                                                        \
+  [C_OTHER] = S, [C_WS] = S, [C_SINGLE] = S, [C_DOT] = S, [C_PLUS] = S,        \
+  [C_MINUS] = S, [C_LT] = S, [C_GT] = S, [C_EQ] = S, [C_BANG] = S,             \
+  [C_SLASH] = S, [C_ZERO] = S, [C_DIGIT] = S, [C_E] = S, [C_LETTER] = S,       \
+  [C_UNDERSCORE] = S
+
+// Characters of identifier
+#define ID_CLASSES(S)                                                          \
+  [C_ZERO] = S, [C_DIGIT] = S, [C_E] = S, [C_LETTER] = S, [C_UNDERSCORE] = S
+
+/**
+ * Next state for (state x class), D_STOP when token ends
+ * End of input is not consumed, so state that reads C_EOF must stop after it
+ */
+const unsigned char dfa_next[D_COUNT][C_COUNT] = {
+    [D_START] = {[C_WS] = D_START, [C_NL] = D_START, [C_EOF] = D_END,
+                 [C_SINGLE] = D_SINGLE, [C_DOT] = D_SINGLE,
+                 [C_PLUS] = D_SINGLE, [C_MINUS] = D_SINGLE, [C_LT] = D_LT,
+                 [C_GT] = D_GT, [C_EQ] = D_ASSIGN, [C_BANG] = D_BANG,
+                 [C_SLASH] = D_DIV, [C_QUOTE] = D_STR,
+                 [C_BACKSLASH] = D_ML_START, [C_ZERO] = D_INT0,
+                 [C_DIGIT] = D_INT1, [C_E] = D_ID, [C_LETTER] = D_ID,
+                 [C_UNDERSCORE] = D_UNDERSCORE},
+    [D_LT] = {[C_EQ] = D_LEQ},
+    [D_GT] = {[C_EQ] = D_GEQ},
+    [D_ASSIGN] = {[C_EQ] = D_EQ},
+    [D_BANG] = {[C_EQ] = D_NEQ},
+    [D_DIV] = {[C_SLASH] = D_COMMENT},
+    [D_COMMENT] = {TEXT_CLASSES(D_COMMENT), [C_QUOTE] = D_COMMENT,
+                   [C_BACKSLASH] = D_COMMENT, [C_NL] = D_START,
+                   [C_EOF] = D_START},
+    [D_INT0] = {[C_DOT] = D_DOT, [C_E] = D_EXP, [C_ZERO] = D_BAD_INT,
+                [C_DIGIT] = D_BAD_INT},
+    [D_INT1] = {[C_DOT] = D_DOT, [C_E] = D_EXP, [C_ZERO] = D_INT1,
+                [C_DIGIT] = D_INT1},
+    [D_DOT] = {[C_ZERO] = D_FLOAT_D, [C_DIGIT] = D_FLOAT_D},
+    [D_FLOAT_D] = {[C_ZERO] = D_FLOAT_D, [C_DIGIT] = D_FLOAT_D, [C_E] = D_EXP},
+    [D_EXP] = {[C_PLUS] = D_EXPS, [C_MINUS] = D_EXPS, [C_DIGIT] = D_FLOAT_E},
+    [D_EXPS] = {[C_DIGIT] = D_FLOAT_E},
+    [D_FLOAT_E] = {[C_ZERO] = D_FLOAT_E, [C_DIGIT] = D_FLOAT_E},
+    [D_UNDERSCORE] = {ID_CLASSES(D_ID)},
+    [D_ID] = {ID_CLASSES(D_ID)},
+    [D_STR] = {TEXT_CLASSES(D_STR), [C_BACKSLASH] = D_STR_ESC,
+               [C_QUOTE] = D_STR_END},
+    // Escape is checked when string is decoded
+    [D_STR_ESC] = {TEXT_CLASSES(D_STR), [C_NL] = D_STR, [C_QUOTE] = D_STR,
+                   [C_BACKSLASH] = D_STR},
+    [D_ML_START] = {[C_BACKSLASH] = D_ML_LINE},
+    [D_ML_LINE] = {TEXT_CLASSES(D_ML_LINE), [C_QUOTE] = D_ML_LINE,
+                   [C_BACKSLASH] = D_ML_LINE, [C_NL] = D_ML_GAP},
+    [D_ML_GAP] = {[C_WS] = D_ML_GAP, [C_NL] = D_ML_GAP,
+                  [C_BACKSLASH] = D_ML_START},
+};
+
+/**
+ * Token type when automaton stops in state
+ */
+const signed char dfa_accept[D_COUNT] = {
+    [D_STOP] = DFA_REJECT,      [D_START] = DFA_REJECT,
+    [D_END] = T_EOF,            [D_SINGLE] = DFA_SINGLE,
+    [D_LT] = T_LT,              [D_LEQ] = T_LEQ,
+    [D_GT] = T_GT,              [D_GEQ] = T_GEQ,
+    [D_ASSIGN] = T_ASSIGN,      [D_EQ] = T_EQ,
+    [D_BANG] = DFA_REJECT,      [D_NEQ] = T_NEQ,
+    [D_DIV] = T_DIV,            [D_COMMENT] = DFA_REJECT,
+    [D_INT0] = T_INT,           [D_INT1] = T_INT,
+    [D_BAD_INT] = DFA_REJECT,   [D_DOT] = DFA_REJECT,
+    [D_FLOAT_D] = T_FLOAT,      [D_EXP] = DFA_REJECT,
+    [D_EXPS] = DFA_REJECT,      [D_FLOAT_E] = T_FLOAT,
+    [D_UNDERSCORE] = T_UNDERSCORE, [D_ID] = T_ID,
+    [D_STR] = DFA_REJECT,       [D_STR_ESC] = DFA_REJECT,
+    [D_STR_END] = T_STR,        [D_ML_START] = DFA_REJECT,
+    [D_ML_LINE] = T_STR,        [D_ML_GAP] = T_STR,
+};
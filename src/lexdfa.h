@@ -0,0 +1,85 @@
+/**
+ * @file lexdfa.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Transition tables of scanner automaton header file
+ *
+ * Same automaton as docs/FSM.png, but as tables:
+ * every byte is mapped to character class and (state x class) gives next state
+ */
+
+#ifndef LEXDFA_H
+#define LEXDFA_H
+
+#include "scanner.h"
+
+typedef enum CharClass {
+  C_OTHER = 0,  // Character that can't start any token
+  C_WS,         // Whitespace except new line
+  C_NL,         // \n
+  C_SINGLE,     // ; : , ( ) [ ] { } | @ ? *
+  C_DOT,        // .
+  C_PLUS,       // +
+  C_MINUS,      // -
+  C_LT,         // <
+  C_GT,         // >
+  C_EQ,         // =
+  C_BANG,       // !
+  C_SLASH,      // /
+  C_QUOTE,      // "
+  C_BACKSLASH,  // \ (backslash)
+  C_ZERO,       // 0
+  C_DIGIT,      // 1-9
+  C_E,          // e E
+  C_LETTER,     // Letters except e E
+  C_UNDERSCORE, // _
+  C_EOF,        // End of input
+  C_COUNT
+} CharClass;
+
+typedef enum DfaState {
+  D_STOP = 0,   // No transition, token ends before current char
+  D_START,
+  D_END,        // End of input was read
+  D_SINGLE,     // One character token
+  D_LT,
+  D_LEQ,
+  D_GT,
+  D_GEQ,
+  D_ASSIGN,
+  D_EQ,
+  D_BANG,
+  D_NEQ,
+  D_DIV,
+  D_COMMENT,
+  D_INT0,
+  D_INT1,
+  D_BAD_INT,    // Leading zero
+  D_DOT,
+  D_FLOAT_D,
+  D_EXP,
+  D_EXPS,
+  D_FLOAT_E,
+  D_UNDERSCORE,
+  D_ID,
+  D_STR,
+  D_STR_ESC,    // Char after backslash in string
+  D_STR_END,
+  D_ML_START,   // Backslash of multiline string line
+  D_ML_LINE,    // Content of multiline string line
+  D_ML_GAP,     // Whitespace between lines of multiline string
+  D_COUNT
+} DfaState;
+
+#define DFA_REJECT -1 // Accept action of states where token can't end
+#define DFA_SINGLE -2 // Accept action of one character token
+
+extern const unsigned char char_class[256];
+extern const unsigned char single_token[256];
+extern const unsigned char dfa_next[D_COUNT][C_COUNT];
+extern const signed char dfa_accept[D_COUNT];
+
+#endif // LEXDFA_H
@@ -9,21 +9,66 @@
 
 #include "memory.h"
 #include "parser.h"
+#include "phase.h"
+#include "trace.h"
 #include "scanner.h"
 #include <stdio.h>
+#include <string.h>
 
-int main() {
+int main(int argc, char *argv[]) {
   FILE *file = stdin;
 
   AllocatorInit();
+
+  // Diagnostic options, code is always read from STDIN
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--mem-stats") == 0) {
+      AllocatorEnableStats();
+    } else if (strcmp(argv[i], "--time-phases") == 0 ||
+               strcmp(argv[i], "--time-phases=table") == 0) {
+      PhasesEnable(PHASES_TABLE);
+    } else if (strcmp(argv[i], "--time-phases=json") == 0) {
+      PhasesEnable(PHASES_JSON);
+    } else if (strncmp(argv[i], "--trace=", 8) == 0) {
+      if (!TraceOpen(argv[i] + 8)) {
+        fprintf(stderr, "Can't open trace file: %s\n", argv[i] + 8);
+        InvokeExit(INTERNAL_ERROR);
+      }
+    } else {
+      fprintf(stderr, "Unknown option: %s\n", argv[i]);
+      InvokeExit(INTERNAL_ERROR);
+    }
+  }
+
+  PhaseBegin("compile");
+  AtomTableInit();
+  PhaseBegin("ScannerInit");
   ScannerInit(file);
+  PhaseEnd();
 
+  PhaseBegin("GenerateTokens");
   GenerateTokens();
+  PhaseEnd();
+  PhaseBegin("Parse");
   Parse();
+  PhaseEnd();
 
+  PhaseBegin("ScannerDestroy");
   ScannerDestroy();
+  PhaseEnd();
+  PhaseBegin("SymtableClear");
   SymtableClear();
+  AtomTableClear();
+  PhaseEnd();
+  PhaseBegin("AllocatorDestroy");
   AllocatorDestroy();
+  PhaseEnd();
+  PhaseEnd();
+
+  // Generated code is complete, phases go after it to stderr
+  fflush(stdout);
+  PhasesPrint(stderr);
+  TraceClose();
 
   return 0;
 }
@@ -8,21 +8,207 @@
  */
 
 #include "memory.h"
+#include "pool.h"
+#include <stdint.h>
 
-List *tracking;
+/**
+ * @brief Header placed right before every tracked allocation
+ * Links all live allocations into one circular doubly linked list,
+ * so registering and unregistering pointer is O(1)
+ */
+typedef union AllocHeader {
+  struct {
+    union AllocHeader *prev;
+    union AllocHeader *next;
+#ifdef MEM_STATS
+    struct AllocSite *site; /**< Call site that owns this memory*/
+    size_t size;            /**< Requested size*/
+#endif
+  } link;
+  max_align_t align; /**< Keeps returned pointer aligned as malloc does*/
+} AllocHeader;
+
+// Sentinel of tracking list
+static AllocHeader tracking;
+
+// If memory statistics have to be printed on destroy
+static bool stats_enabled = false;
+
+#ifdef MEM_STATS
+#define MAX_SITES 1021 // Prime number, there are far less call sites
+
+/**
+ * @brief Statistics of one InvokeAlloc/InvokeStrdup/InvokeRealloc call site
+ */
+typedef struct AllocSite {
+  const char *file;     /**< Source file or name of arena/pool*/
+  int line;             /**< Line of call, 0 for named allocations*/
+  size_t count;         /**< Count of allocations*/
+  size_t bytes;         /**< Total allocated bytes*/
+  size_t live;          /**< Currently allocated bytes*/
+  size_t peak;          /**< Maximum of live bytes*/
+  size_t reallocs;      /**< Count of reallocations*/
+  size_t realloc_bytes; /**< Bytes moved by reallocations*/
+} AllocSite;
+
+static AllocSite sites[MAX_SITES];
+static size_t site_count = 0;
+static size_t total_live = 0;
+static size_t total_peak = 0;
+
+// Sites that don't fit to table, one slot is always free, so probing ends
+static AllocSite overflow_site = {"other sites", 0, 0, 0, 0, 0, 0, 0};
+
+/**
+ * @brief Find or create statistics of call site
+ * Characters of file are hashed, not its address, because the same
+ * file may be passed through different string literals
+ */
+static AllocSite *SiteGet(const char *file, int line) {
+  unsigned int hash = (unsigned int)line * 31u;
+  for (const char *c = file; *c != '\0'; c++)
+    hash = (hash ^ (unsigned char)*c) * 16777619u;
+  unsigned int index = hash % MAX_SITES;
+  while (sites[index].file != NULL) {
+    if (sites[index].line == line && strcmp(sites[index].file, file) == 0)
+      return &sites[index];
+    index = (index + 1) % MAX_SITES;
+  }
+  if (site_count == MAX_SITES - 1)
+    return &overflow_site;
+  site_count++;
+  sites[index].file = file;
+  sites[index].line = line;
+  return &sites[index];
+}
+
+/**
+ * @brief Account new block to call site
+ */
+static void SiteAdd(AllocHeader *header, size_t size, const char *file, int line) {
+  AllocSite *site = SiteGet(file, line);
+  header->link.site = site;
+  header->link.size = size;
+  site->live += size;
+  if (site->live > site->peak)
+    site->peak = site->live;
+  total_live += size;
+  if (total_live > total_peak)
+    total_peak = total_live;
+}
+
+/**
+ * @brief Remove block from its call site
+ */
+static void SiteRemove(AllocHeader *header) {
+  header->link.site->live -= header->link.size;
+  total_live -= header->link.size;
+}
 
 /**
- * @brief Initialize array for tracking all memory allocations
+ * @brief Compare call sites by peak of live bytes for qsort
  */
-void AllocatorInit() { ArrayInit(&tracking); }
+static int SiteCompare(const void *a, const void *b) {
+  const AllocSite *lhs = *(AllocSite *const *)a;
+  const AllocSite *rhs = *(AllocSite *const *)b;
+  if (lhs->peak != rhs->peak)
+    return lhs->peak < rhs->peak ? 1 : -1;
+  return lhs->count < rhs->count ? 1 : (lhs->count > rhs->count ? -1 : 0);
+}
 
 /**
- * @brief Free all pointers in dynamic array and free itself
+ * @brief Print call sites sorted by peak of live bytes
+ */
+static void SitePrintStats(FILE *out) {
+  AllocSite *sorted[MAX_SITES];
+  size_t count = 0;
+  for (size_t i = 0; i < MAX_SITES; i++) {
+    if (sites[i].file != NULL)
+      sorted[count++] = &sites[i];
+  }
+  if (overflow_site.count > 0 || overflow_site.reallocs > 0)
+    sorted[count++] = &overflow_site;
+  qsort(sorted, count, sizeof(AllocSite *), SiteCompare);
+
+  fprintf(out, "%-28s %10s %12s %12s %10s %12s\n", "site", "allocs", "bytes",
+          "peak", "reallocs", "moved");
+  for (size_t i = 0; i < count; i++) {
+    char name[64];
+    if (sorted[i]->line > 0)
+      snprintf(name, sizeof(name), "%s:%d", sorted[i]->file, sorted[i]->line);
+    else
+      snprintf(name, sizeof(name), "[%s]", sorted[i]->file);
+    fprintf(out, "%-28s %10zu %12zu %12zu %10zu %12zu\n", name,
+            sorted[i]->count, sorted[i]->bytes, sorted[i]->peak,
+            sorted[i]->reallocs, sorted[i]->realloc_bytes);
+  }
+  fprintf(out, "peak live bytes: %zu\n\n", total_peak);
+}
+#endif
+
+#define HEADER_OF(ptr) ((AllocHeader *)(ptr) - 1)
+
+/**
+ * @brief Put header to the tracking list
+ *
+ * @param header Header of allocated memory
+ *
+ * @return Pointer to usable memory after header
+ */
+static void *TrackingLink(AllocHeader *header) {
+  header->link.prev = &tracking;
+  header->link.next = tracking.link.next;
+  tracking.link.next->link.prev = header;
+  tracking.link.next = header;
+  return header + 1;
+}
+
+/**
+ * @brief Remove header from tracking list
+ *
+ * @param header Header of allocated memory
+ */
+static void TrackingUnlink(AllocHeader *header) {
+  header->link.prev->link.next = header->link.next;
+  header->link.next->link.prev = header->link.prev;
+}
+
+/**
+ * @brief Initialize list for tracking all memory allocations
+ */
+void AllocatorInit() {
+  tracking.link.prev = &tracking;
+  tracking.link.next = &tracking;
+}
+
+/**
+ * @brief Print memory statistics to stderr when allocator is destroyed
+ */
+void AllocatorEnableStats() { stats_enabled = true; }
+
+/**
+ * @brief Free all pointers in tracking list
  */
 void AllocatorDestroy() {
-  if (tracking) {
-    ArrayDest(tracking);
+  // Allocator was never initialized
+  if (tracking.link.next == NULL)
+    return;
+
+  if (stats_enabled) {
+#ifdef MEM_STATS
+    SitePrintStats(stderr);
+#endif
+    PoolPrintStats(stderr);
+    stats_enabled = false;
+  }
+
+  AllocHeader *header = tracking.link.next;
+  while (header != &tracking) {
+    AllocHeader *next = header->link.next;
+    free(header);
+    header = next;
   }
+  AllocatorInit();
 }
 
 /**
@@ -32,15 +218,23 @@ void AllocatorDestroy() {
  *
  * @return Pointer to allocated memory
  */
+#ifdef MEM_STATS
+void *InvokeAllocAt(size_t size, const char *file, int line) {
+#else
 void *InvokeAlloc(size_t size) {
+#endif
   if (size <= 0)
     InvokeExit(INTERNAL_ERROR);
-  void *element = malloc(size);
-  if (element == NULL) {
+  AllocHeader *header = malloc(sizeof(AllocHeader) + size);
+  if (header == NULL) {
     InvokeExit(INTERNAL_ERROR);
   }
-  ArrayAdd(tracking, element);
-  return element;
+#ifdef MEM_STATS
+  SiteAdd(header, size, file, line);
+  header->link.site->count++;
+  header->link.site->bytes += size;
+#endif
+  return TrackingLink(header);
 }
 
 /**
@@ -50,11 +244,16 @@ void *InvokeAlloc(size_t size) {
  *
  * @return Pointer from strdup
  */
+#ifdef MEM_STATS
+char *InvokeStrdupAt(const char *s, const char *file, int line) {
+  size_t size = strlen(s) + 1;
+  char *str = InvokeAllocAt(size, file, line);
+#else
 char *InvokeStrdup(const char *s) {
-  char *str = strdup(s);
-  if (str == NULL)
-    InvokeExit(INTERNAL_ERROR);
-  ArrayAdd(tracking, str);
+  size_t size = strlen(s) + 1;
+  char *str = InvokeAlloc(size);
+#endif
+  memcpy(str, s, size);
   return str;
 }
 
@@ -66,17 +265,40 @@ char *InvokeStrdup(const char *s) {
  *
  * @return New reallocated pointer
  */
+#ifdef MEM_STATS
+void *InvokeReallocAt(void *element, size_t size, const char *file, int line) {
+  if (element == NULL)
+    return InvokeAllocAt(size, file, line);
+#else
 void *InvokeRealloc(void *element, size_t size) {
+  if (element == NULL)
+    return InvokeAlloc(size);
+#endif
   if (size <= 0)
     InvokeExit(INTERNAL_ERROR);
-  ArrayRemove(tracking, element);
-  void *new_element = realloc(element, size);
-  if (element == NULL) {
+  AllocHeader *header = HEADER_OF(element);
+#ifdef MEM_STATS
+  size_t old_size = header->link.size;
+  uintptr_t old_address = (uintptr_t)header;
+#endif
+  TrackingUnlink(header);
+  AllocHeader *new_header = realloc(header, sizeof(AllocHeader) + size);
+  if (new_header == NULL) {
+    // Old block is still valid, give it back so exit can free it
+    TrackingLink(header);
     InvokeExit(INTERNAL_ERROR);
   }
+#ifdef MEM_STATS
+  // Reallocated block now belongs to site of realloc
+  SiteRemove(new_header);
+  SiteAdd(new_header, size, file, line);
+  new_header->link.site->reallocs++;
+  // Only block that didn't stay in place is copied
+  if ((uintptr_t)new_header != old_address)
+    new_header->link.site->realloc_bytes += old_size < size ? old_size : size;
+#endif
   //Add new pointer to tracking list
-  ArrayAdd(tracking, new_element);
-  return new_element;
+  return TrackingLink(new_header);
 }
 
 /**
@@ -86,8 +308,12 @@ void *InvokeRealloc(void *element, size_t size) {
  */
 void InvokeFree(void *element) {
   if (element) {
-    ArrayRemove(tracking, element);
-    free(element);
+    AllocHeader *header = HEADER_OF(element);
+    TrackingUnlink(header);
+#ifdef MEM_STATS
+    SiteRemove(header);
+#endif
+    free(header);
   }
 }
 
@@ -100,33 +326,3 @@ void InvokeExit(int code) {
   AllocatorDestroy();
   exit(code);
 }
-
-/**
- * @brief Special function for safe memory initializing dynamic array
- * Will contain variable names for code generation
- *
- * @param arr dynamic array of variables
- */
-void InvokeInitVarsArray(List **arr) {
-  ArrayInit(arr);
-  ArrayAdd(tracking, (*arr));
-  ArrayAdd(tracking, (*arr)->array);
-}
-
-/**
- * @brief Special function for safe memory adding element to dynamic array
- *
- * @param arr dynamic array of variables
- * @param element name of variable
- */
-void InvokeAddVarsArray(List *arr, void *element) {
-  if(ArrayFindStr(arr, element) != NULL) return;
-  void **temp = arr->array;
-  ArrayAdd(arr, element);
-  //in case realloc changed pointer
-  if (arr->array != temp) {
-    ArrayRemove(tracking, temp);
-    ArrayAdd(tracking, arr->array);
-    temp = NULL;
-  }
-}
\ No newline at end of file
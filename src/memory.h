@@ -12,16 +12,32 @@
 
 #include "array.h"
 #include "error.h"
+#include <stddef.h>
 #include <string.h>
 
 void AllocatorInit();
+void AllocatorEnableStats();
 void AllocatorDestroy();
+
+#ifdef MEM_STATS
+// Profiling build (make MEM_STATS=1), every allocation remembers its call site
+void *InvokeAllocAt(size_t size, const char *file, int line);
+char *InvokeStrdupAt(const char *s, const char *file, int line);
+void *InvokeReallocAt(void *element, size_t size, const char *file, int line);
+#define InvokeAlloc(size) InvokeAllocAt((size), __FILE__, __LINE__)
+#define InvokeStrdup(s) InvokeStrdupAt((s), __FILE__, __LINE__)
+#define InvokeRealloc(element, size)                                           \
+  InvokeReallocAt((element), (size), __FILE__, __LINE__)
+// Allocation which is reported under given name instead of call site
+#define InvokeAllocNamed(size, name) InvokeAllocAt((size), (name), 0)
+#else
 void *InvokeAlloc(size_t size);
 char *InvokeStrdup(const char *s);
 void *InvokeRealloc(void *element, size_t size);
+#define InvokeAllocNamed(size, name) ((void)(name), InvokeAlloc(size))
+#endif
+
 void InvokeFree(void *element);
 void InvokeExit(int code);
-void InvokeInitVarsArray(List **arr);
-void InvokeAddVarsArray(List *arr, void *element);
 
 #endif
@@ -23,30 +23,76 @@ symtable_item_data *current_func_sym;
  * Get next token from token array
  */
 void GetNextToken() {
-  token = *scanner->tokens[scanner->current_token];
+  ScannerGetToken(scanner->current_token, &token);
   scanner->current_token++;
 }
 
+// Names of phases of Parse, as they are timed by --time-phases
+static const char *parse_phase_names[PARSE_PHASE_COUNT] = {
+    "FirstPassSymtable", "ParseProlog", "SymtableAssertReturns", "CgenStart"};
+
+/**
+ * @brief Name of phase of Parse
+ *
+ * @param phase Phase
+ */
+const char *ParsePhaseName(ParsePhase phase) { return parse_phase_names[phase]; }
+
+/**
+ * @brief Hook of Parse, times phases for --time-phases and --trace
+ */
+static void ParsePhaseHook(ParsePhase phase, bool begin, void *context) {
+  (void)context;
+  if (begin)
+    PhaseBegin(ParsePhaseName(phase));
+  else
+    PhaseEnd();
+}
+
 /**
  * @brief Main function of parser
  */
-void Parse() {
+void Parse() { ParseWithHooks(ParsePhaseHook, NULL); }
+
+/**
+ * @brief Parse tokens and generate code, hook is called at begin
+ * and at end of every phase, so benchmarks measure the same pipeline
+ *
+ * @param hook Called with begin true before phase and false after it
+ * @param context Passed to hook
+ */
+void ParseWithHooks(ParseHook hook, void *context) {
   SymtableInit();
+  BuiltinAtomsReset();
 
   // First pass parsing
   first_pass = true;
+  hook(PARSE_FIRST_PASS, true, context);
   FirstPassSymtable();
+  hook(PARSE_FIRST_PASS, false, context);
   scanner->current_token = 0;
 
   // Second pass parsing
   first_pass = false;
-    ParseProlog();
+  hook(PARSE_PROLOG, true, context);
+  ParseProlog();
+  hook(PARSE_PROLOG, false, context);
 
   //Assert that all function had return(besides void function)
+  hook(PARSE_ASSERT_RETURNS, true, context);
   SymtableAssertReturns();
+  hook(PARSE_ASSERT_RETURNS, false, context);
 
   //AST is ready, calling code generator
+  hook(PARSE_CGEN, true, context);
   CgenStart(ast_start);
+  hook(PARSE_CGEN, false, context);
+
+  //AST is not needed after code generation
+  ArenaRelease(ARENA_AST);
+  ArenaRelease(ARENA_EXPR);
+  PoolRelease(&stack_pool);
+  PoolRelease(&expr_pool);
 }
 
 /**
@@ -64,13 +110,15 @@ void FirstPassSymtable() {
   }
   ParseFuncDecl(NULL);
   // Main function semantics
-  symtable_item_data *main_func = SymtableAssertFunction("main");
+  symtable_item_data *main_func = SymtableAssertFunction(AtomInternStr("main"));
   // Main function can only be return type of void
   if (main_func->details.func.returnType != ST_VOID)
     InvokeExit(PARAMETER_RETURN_ERROR);
   // Main function can't have any arguments
   if (main_func->details.func.params->size != 0)
     InvokeExit(PARAMETER_RETURN_ERROR);
+  // All functions are known, second pass only reads them
+  SymtableSealFunctions();
 }
 
 /**
@@ -99,7 +147,7 @@ void ParseProlog() {
       if (token.type== T_AT)break;
       InvokeExit(SYNTAX_ERROR);break;
     case 4:
-      if (token.type == T_ID && StringEquals(token.value.string, "import")) break;
+      if (token.type == T_ID && token.keyword == K_UNKNOWN && token.value.atom == AtomInternStr("import")) break;
       InvokeExit(SYNTAX_ERROR);break;
     case 5:
       if (token.type == T_OPAREN) break;
@@ -145,15 +193,17 @@ void ParseFuncDecl(ASTFuncDecl **func_decl) {
   //fill symtable
   if (first_pass) {
     //Semantic check(no overloading in IFJ24)
-    if (SymtableFind(token.value.string->str) != NULL) InvokeExit(REDIFINE_ERROR);
-    symtable_item_data *func_item = SymtableAdd(token.value.string->str, ST_FUNC);
+    if (SymtableFind(token.value.atom) != NULL) InvokeExit(REDIFINE_ERROR);
+    symtable_item_data *func_item = SymtableAdd(token.value.atom, ST_FUNC);
     current_func_sym = func_item;
   }
   //fill AST node
   else {
-    current_func_sym = SymtableFind(token.value.string->str);
+    current_func_sym = SymtableFind(token.value.atom);
+    // Parameters and variables live in local table of this function
+    SymtableEnterFunction();
     (*func_decl) = CreateASTFuncDecl();
-    (*func_decl)->name = token.value.string->str;
+    (*func_decl)->name = token.value.atom;
   }
   GetNextToken();
 
@@ -207,7 +257,17 @@ void ParseFuncDecl(ASTFuncDecl **func_decl) {
   }
 
   //Otherwise we continue to parse function body
-  else ParseBody(&(*func_decl)->body, true);
+  TraceSetFunction((*func_decl)->name->str);
+  double trace_start = TraceStart();
+  // Current token is { of body
+  (*func_decl)->first_token = scanner->current_token - 1;
+  ParseBody(&(*func_decl)->body, true);
+  // Current token is the one after }
+  (*func_decl)->last_token = scanner->current_token - 2;
+  TraceSpan("ParseFuncDecl", trace_start, (*func_decl)->first_token,
+            (*func_decl)->last_token);
+  TraceSetFunction(NULL);
+  SymtableLeaveFunction();
 
   // All variables that was declared in function
   (*func_decl)->variables = current_func_sym->details.func.variables;
@@ -256,17 +316,19 @@ void ParseParam(ASTParam **params) {
   //fill symtable
   if (first_pass) {
     if (token.type == T_ID && token.keyword == K_UNKNOWN) {
-      param_func = InvokeAlloc(sizeof(Param));
-      param_func->name = token.value.string->str;
-      InvokeAddVarsArray(current_func_sym->details.func.params, param_func);
+      param_func = ArenaAlloc(ARENA_SYMTABLE, sizeof(Param));
+      param_func->name = token.value.atom;
+      //Two parameters with the same name
+      if (!VarSetAdd(current_func_sym->details.func.params, param_func->name, param_func))
+        InvokeExit(REDIFINE_ERROR);
     }
     else InvokeExit(SYNTAX_ERROR);
   }
   //fill AST node
   else {
-    if(SymtableFind(token.value.string->str) != NULL) InvokeExit(REDIFINE_ERROR);
-    param_var = SymtableAdd(token.value.string->str, ST_VAR_CONST);
-    (*params)->name = token.value.string->str;
+    if(SymtableFind(token.value.atom) != NULL) InvokeExit(REDIFINE_ERROR);
+    param_var = SymtableAdd(token.value.atom, ST_VAR_CONST);
+    (*params)->name = token.value.atom;
   }
   GetNextToken();
 
@@ -410,7 +472,7 @@ void ParseStatement(ASTStatement **statement) {
 
   //Variable redefinition and users function call parsing
   else if (token.type == T_ID && token.keyword == K_UNKNOWN) {
-    char *name = token.value.string->str;
+    Atom *name = token.value.atom;
     GetNextToken();
 
     //Variable redefinition in case next token is =
@@ -558,21 +620,21 @@ void ParseWhileStatement(ASTWhileStatement **statement) {
  *
  * @return name of not null variable in this scope
  */
-char* ParseNotNull(DataType nullable_type) {
-  char* notnull_name = NULL;
+Atom* ParseNotNull(DataType nullable_type) {
+  Atom* notnull_name = NULL;
 
   //Other semantic error, because LL grammar let us go without this part
   if(token.type != T_PIPE) InvokeExit(OTHER_SEMANTIC_ERROR);
   GetNextToken();
 
   if(token.type == T_ID && token.keyword == K_UNKNOWN) {
-    notnull_name = token.value.string->str;
+    notnull_name = token.value.atom;
 
     //Already entered scope before
     //Adding this variable to this scope
-    if(SymtableFind(token.value.string->str) != NULL) InvokeExit(REDIFINE_ERROR);
-    symtable_item_data *nullable_var = SymtableAdd(token.value.string->str, ST_VAR_CONST);
-    InvokeAddVarsArray(current_func_sym->details.func.variables, token.value.string->str);
+    if(SymtableFind(token.value.atom) != NULL) InvokeExit(REDIFINE_ERROR);
+    symtable_item_data *nullable_var = SymtableAdd(token.value.atom, ST_VAR_CONST);
+    VarSetAdd(current_func_sym->details.func.variables, token.value.atom, token.value.atom);
 
     if(nullable_type==ST_NULLI32) nullable_var->details.var.type = ST_I32;
     else if(nullable_type==ST_NULLF64) nullable_var->details.var.type = ST_F64;
@@ -580,7 +642,7 @@ char* ParseNotNull(DataType nullable_type) {
     else if(nullable_type==ST_NULL) nullable_var->details.var.type = ST_NULL;
   }
   //Ignoring variable
-  else if(token.type == T_UNDERSCORE) notnull_name = "_";
+  else if(token.type == T_UNDERSCORE) notnull_name = AtomInternStr("_");
   else InvokeExit(SYNTAX_ERROR);
   GetNextToken();
   if(token.type != T_PIPE) InvokeExit(SYNTAX_ERROR);
@@ -604,14 +666,14 @@ void ParseVarDecl(SymbolType const_type, ASTVarDeclDef *var_decl) {
   if (token.type == T_ID && token.keyword == K_UNKNOWN) {
 
     // Semantic check on redefining variable with the same name in certain scope
-    if (SymtableFind(token.value.string->str) != NULL)
+    if (SymtableFind(token.value.atom) != NULL)
       InvokeExit(REDIFINE_ERROR);
 
-    var_item = SymtableAdd(token.value.string->str, const_type);
+    var_item = SymtableAdd(token.value.atom, const_type);
 
-    var_decl->name = token.value.string->str;
-    InvokeAddVarsArray(current_func_sym->details.func.variables,
-              token.value.string->str);
+    var_decl->name = token.value.atom;
+    VarSetAdd(current_func_sym->details.func.variables, token.value.atom,
+              token.value.atom);
     GetNextToken();
 
     //type which is optional in var/const declaration
@@ -694,7 +756,7 @@ void ParseReturn(ASTReturn *statement_return) {
  * @return Type of expression
  */
 DataType ParseExpr(ASTExpression *expression, bool additional_parenthesis, bool additional_comma) {
-  expression->exprStack = InvokeAlloc(sizeof(stack));
+  expression->exprStack = ArenaAlloc(ARENA_AST, sizeof(stack));
   InitStack(expression->exprStack);
   DataType expr_type = PrecedeneParseExpression(&expression->exprStack, additional_parenthesis, additional_comma);
   expression->returnType = expr_type;
@@ -738,185 +800,40 @@ DataType ParseFuncCall(ASTFuncCall *func_call) {
     if(token.type != T_OPAREN)InvokeExit(SYNTAX_ERROR);
     GetNextToken();
 
-    // ifj.write(term) void
-    if (StringEquals(ifj_token.value.string, "write")) {
-      expected_args=1;
-      func_call->name = "ifj.write";
-      //no parameters
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-
-      //term | term can't be void
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_VOID, param_type)) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_VOID;
-    }
-
-    // ifj.readstr() ?[]u8
-    else if (StringEquals(ifj_token.value.string, "readstr")) {
-      expected_args=0;
-      func_call->name = "ifj.readstr";
-      return_type = ST_NULLU8;
-    }
-
-    // ifj.readi32() ?i32
-    else if (StringEquals(ifj_token.value.string, "readi32")) {
-      expected_args=0;
-      func_call->name = "ifj.readi32";
-      return_type = ST_NULLI32;
-    }
-
-    // ifj.readf64() ?f64
-    else if (StringEquals(ifj_token.value.string, "readf64")) {
-      expected_args=0;
-      func_call->name = "ifj.readf64";
-      return_type = ST_NULLF64;
-    }
-
-    // ifj.i2f(term ∶ i32) f64
-    else if (StringEquals(ifj_token.value.string, "i2f")) {
-      expected_args=1;
-      func_call->name = "ifj.i2f";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      //term
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_I32, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_F64;
-    }
-
-    // ifj.f2i(term ∶ f64) i32
-    else if (StringEquals(ifj_token.value.string, "f2i")) {
-      expected_args=1;
-      func_call->name = "ifj.f2i";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      //term
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_F64, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_I32;
-    }
-
-    // ifj.string(term) []u8
-    else if (StringEquals(ifj_token.value.string, "string")) {
-      expected_args=1;
-      func_call->name = "ifj.string";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      //term must be string literal or u8
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_STRING, param_type) == false &&
-              CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_U8;
-    }
-
-    // ifj.length(s : []u8) i32
-    else if (StringEquals(ifj_token.value.string, "length")) {
-      expected_args=1;
-      func_call->name = "ifj.length";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      // s
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_I32;
-    }
-
-    // ifj.concat(s1 : []u8, s2 : []u8) []u8
-    else if (StringEquals(ifj_token.value.string, "concat")) {
-      expected_args=2;
-      func_call->name = "ifj.concat";
+    // Name is resolved once, signature comes from table of ifj functions
+    func_call->builtin = BuiltinLookup(ifj_token.value.atom->str,
+                                       ifj_token.value.atom->length);
+    if (func_call->builtin == BUILTIN_NONE) InvokeExit(DEFINITION_ERROR);
+    const BuiltinInfo *info = BuiltinGetInfo(func_call->builtin);
+    expected_args = info->arity;
+    func_call->name = BuiltinAtom(func_call->builtin);
 
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      // s1
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type != T_COMMA) InvokeExit(SYNTAX_ERROR);
-      GetNextToken();
-
-      // s2
-      param_type = ParseCallParam(&func_call->params->next);
-      if(CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_U8;
-    }
-
-    // ifj.substring(s : []u8, i : i32, j : i32) ?[]u8
-    else if (StringEquals(ifj_token.value.string, "substring")) {
-      expected_args=3;
-      func_call->name = "ifj.substring";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      // s
-      param_type = ParseCallParam(&func_call->params);
-      if(CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type != T_COMMA) InvokeExit(SYNTAX_ERROR);
-      GetNextToken();
-      // i
-      param_type = ParseCallParam(&func_call->params->next);
-      if(CheckParamTypes(ST_I32, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type != T_COMMA) InvokeExit(SYNTAX_ERROR);
-      GetNextToken();
-      // j
-      param_type = ParseCallParam(&func_call->params->next->next);
-      if (CheckParamTypes(ST_I32, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_NULLU8;
-    }
-
-    // ifj.strcmp(s1 : []u8, s2 : []u8) i32
-    else if (StringEquals(ifj_token.value.string, "strcmp")) {
-      expected_args=2;
-      func_call->name = "ifj.strcmp";
-
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      // s1
-      param_type = ParseCallParam(&func_call->params);
-      if (CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type != T_COMMA) InvokeExit(SYNTAX_ERROR);
-      GetNextToken();
-      // s2
-      param_type = ParseCallParam(&func_call->params->next);
-      if (CheckParamTypes(ST_U8, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_I32;
-    }
-
-    // ifj.ord(s : []u8, i : i32) i32
-    else if (StringEquals(ifj_token.value.string, "ord")) {
-      expected_args=2;
-      func_call->name = "ifj.ord";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      // s1
-      param_type = ParseCallParam(&func_call->params);
-      if (CheckParamTypes(ST_U8, param_type) == false)InvokeExit(PARAMETER_RETURN_ERROR);
+    ASTParamCall **current = &func_call->params;
+    for (int i = 0; i < info->arity; i++) {
       if (token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      if (token.type != T_COMMA) InvokeExit(SYNTAX_ERROR);
-      GetNextToken();
-      // i
-      param_type = ParseCallParam(&func_call->params->next);
-      if (CheckParamTypes(ST_I32, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_I32;
-    }
-
-    // ifj.chr(i : i32) []u8
-    else if (StringEquals(ifj_token.value.string, "chr")) {
-      expected_args=1;
-      func_call->name = "ifj.chr";
-      if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
-      //i
-      param_type = ParseCallParam(&func_call->params);
-      if (CheckParamTypes(ST_I32, param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
-      return_type = ST_U8;
+      // try to consume comma before every but first param
+      if (i > 0) {
+        if (token.type != T_COMMA) InvokeExit(SYNTAX_ERROR);
+        GetNextToken();
+      }
+      param_type = ParseCallParam(current);
+      if (CheckBuiltinParam(info->params[i], param_type) == false) InvokeExit(PARAMETER_RETURN_ERROR);
+      current = &(*current)->next;
     }
-
-    else InvokeExit(DEFINITION_ERROR);
+    return_type = info->result;
   }
 
   // DEFAULT FUNCTION CALL
   else {
-    func_call->name = token.value.string->str;
+    func_call->name = token.value.atom;
 
-    // Find function in symtable with semantics check
+    // Find function by id of its atom with semantics check
     symtable_item_data *func = SymtableAssertFunction(func_call->name);
+    func_call->func_id = func->details.func.id;
+    func_call->func = &func->details.func;
     //Count of function parameters
-    expected_args=func->details.func.params->size;
-    return_type = func->details.func.returnType;
+    expected_args=func_call->func->params->size;
+    return_type = func_call->func->returnType;
     // consume id
     GetNextToken();
 
@@ -926,14 +843,14 @@ DataType ParseFuncCall(ASTFuncCall *func_call) {
     ASTParamCall **current = &func_call->params;
 
     // Cycle through params in symtable function item
-    for (size_t i = 0; i < func->details.func.params->size; i++) {
-      Param *symtable_param = func->details.func.params->array[i];
+    for (size_t i = 0; i < func_call->func->params->size; i++) {
+      Param *symtable_param = func_call->func->params->array[i];
 
       param_type = ParseCallParam(current);
       if (CheckParamTypes(symtable_param->type,param_type) == false)InvokeExit(PARAMETER_RETURN_ERROR);
 
       // try to consume comma if it isn't last param
-      if (i != func->details.func.params->size - 1) {
+      if (i != func_call->func->params->size - 1) {
         if(token.type == T_CPAREN) InvokeExit(PARAMETER_RETURN_ERROR);
         else if (token.type != T_COMMA)InvokeExit(SYNTAX_ERROR);
         GetNextToken();
@@ -1055,3 +972,20 @@ bool CheckParamTypes(DataType expected, DataType actual){
   else if(expected == actual) return true;
   return false;
 }
+
+/**
+ * @brief Semantics check of parameter of ifj function
+ *
+ * @param expected Type from BuiltinInfo
+ * @param actual Type of parameter expression
+ *
+ * @return true if types are compatible
+ */
+bool CheckBuiltinParam(DataType expected, DataType actual){
+  //term of ifj.write can't be void
+  if (expected == ST_VOID) return CheckParamTypes(ST_VOID, actual) == false;
+  //term of ifj.string must be string literal or u8
+  if (expected == ST_STRING)
+    return CheckParamTypes(ST_STRING, actual) || CheckParamTypes(ST_U8, actual);
+  return CheckParamTypes(expected, actual);
+}
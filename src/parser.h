@@ -24,10 +24,28 @@
 #include <stdlib.h>
 #include <string.h>
 
+// Root node of AST, filled by ParseProlog
+extern ASTStart *ast_start;
+// If parser runs its first pass (FirstPassSymtable)
+extern bool first_pass;
+
+typedef enum ParsePhase {
+  PARSE_FIRST_PASS = 0, // FirstPassSymtable
+  PARSE_PROLOG,         // ParseProlog, second pass
+  PARSE_ASSERT_RETURNS, // SymtableAssertReturns
+  PARSE_CGEN,           // CgenStart
+  PARSE_PHASE_COUNT
+} ParsePhase;
+
+// Called before (begin is true) and after every phase of ParseWithHooks
+typedef void (*ParseHook)(ParsePhase phase, bool begin, void *context);
+
 void GetNextToken();
 void FirstPassSymtable();
 
 void Parse();
+void ParseWithHooks(ParseHook hook, void *context);
+const char *ParsePhaseName(ParsePhase phase);
 void ParseProlog();
 void ParseFuncDecl(ASTFuncDecl **func_decl);
 void ParseFuncDeclNext(ASTFuncDecl **func_decl);
@@ -43,7 +61,7 @@ void ParseStatementNext(ASTStatement **statement);
 void ParseIfStatement(ASTIfStatement **statement);
 void ParseElseStatement(ASTIfStatement **statement);
 void ParseWhileStatement(ASTWhileStatement **statement);
-char* ParseNotNull(DataType nullable_type);
+Atom* ParseNotNull(DataType nullable_type);
 
 void ParseVarDecl(SymbolType const_type, ASTVarDeclDef *var_decl);
 DataType ParseVarDef(ASTVarDeclDef *var_decl);
@@ -58,5 +76,6 @@ DataType ParseType();
 
 bool CheckNullableTypes(DataType base, DataType from_expression);
 bool CheckParamTypes(DataType expected, DataType actual);
+bool CheckBuiltinParam(DataType expected, DataType actual);
 
 #endif
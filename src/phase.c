@@ -0,0 +1,195 @@
+/**
+ * @file phase.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Timing of compiler phases and work counters
+ *
+ * Phases are nested scopes between PhaseBegin and PhaseEnd, measured by
+ * monotonic clock. Phase of the same name under the same parent is
+ * accumulated to one record, so it can be begun many times.
+ * With --trace every phase is also written as trace span
+ */
+
+#include "phase.h"
+#include "trace.h"
+
+/**
+ * @brief Accumulated time of one phase
+ */
+typedef struct PhaseRecord {
+  const char *name; /**< Name of phase, string has to outlive records*/
+  int parent;       /**< Index of parent record or -1*/
+  size_t calls;     /**< Count of PhaseBegin*/
+  double total;     /**< Seconds spent in phase*/
+} PhaseRecord;
+
+size_t phase_counters[COUNTER_COUNT];
+size_t probe_lengths[PROBE_BUCKETS];
+
+static const char *counter_names[COUNTER_COUNT] = {
+    "tokens", "ast_nodes", "symtable_probes", "instructions"};
+
+static PhaseFormat phase_format = PHASES_OFF;
+
+static PhaseRecord records[PHASE_MAX];
+static int record_count = 0;
+
+// Open phases: their records (-1 if not recorded), names and start times
+static int open_records[PHASE_DEPTH_MAX];
+static const char *open_names[PHASE_DEPTH_MAX];
+static double open_starts[PHASE_DEPTH_MAX];
+static int open_count = 0;
+
+/**
+ * @brief Current time in seconds from monotonic clock
+ */
+double PhaseNow() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Start timing phases, they are printed by PhasesPrint
+ *
+ * @param format Format of printed phases
+ */
+void PhasesEnable(PhaseFormat format) { phase_format = format; }
+
+/**
+ * @brief If phases are timed
+ */
+bool PhasesEnabled() { return phase_format != PHASES_OFF; }
+
+/**
+ * @brief Enter phase, it's nested in the current phase
+ *
+ * @param name Name of phase (string literal)
+ */
+void PhaseBegin(const char *name) {
+  if (phase_format == PHASES_OFF && !TraceEnabled())
+    return;
+  // Too deep phases are not timed, but they still have to be ended
+  if (open_count >= PHASE_DEPTH_MAX) {
+    open_count++;
+    return;
+  }
+
+  int index = -1;
+  if (phase_format != PHASES_OFF) {
+    int parent = open_count > 0 ? open_records[open_count - 1] : -1;
+    index = 0;
+    while (index < record_count && (records[index].parent != parent ||
+                                    strcmp(records[index].name, name) != 0))
+      index++;
+    if (index == PHASE_MAX) {
+      index = -1;
+    } else {
+      if (index == record_count)
+        records[record_count++] = (PhaseRecord){name, parent, 0, 0};
+      records[index].calls++;
+    }
+  }
+
+  open_records[open_count] = index;
+  open_names[open_count] = name;
+  open_starts[open_count++] = PhaseNow();
+}
+
+/**
+ * @brief Leave the current phase
+ */
+void PhaseEnd() {
+  if (open_count == 0)
+    return;
+  open_count--;
+  if (open_count >= PHASE_DEPTH_MAX)
+    return;
+  double end = PhaseNow();
+  if (open_records[open_count] >= 0)
+    records[open_records[open_count]].total += end - open_starts[open_count];
+  TraceEvent(open_names[open_count], 0, open_starts[open_count], end,
+             TRACE_NO_TOKENS, 0);
+}
+
+/**
+ * @brief Total time of top level phases
+ */
+static double PhasesTotal() {
+  double total = 0;
+  for (int i = 0; i < record_count; i++) {
+    if (records[i].parent < 0)
+      total += records[i].total;
+  }
+  return total;
+}
+
+/**
+ * @brief Print record and its children as rows of table
+ */
+static void PrintTableRows(FILE *out, int parent, int depth, double total) {
+  for (int i = 0; i < record_count; i++) {
+    if (records[i].parent != parent)
+      continue;
+    fprintf(out, "%*s%-*s %8zu %12.3f %7.1f%%\n", depth * 2, "",
+            32 - depth * 2, records[i].name, records[i].calls,
+            records[i].total * 1e3,
+            total > 0 ? records[i].total / total * 100 : 0.0);
+    PrintTableRows(out, i, depth + 1, total);
+  }
+}
+
+/**
+ * @brief Print children of record as JSON array
+ */
+static void PrintJsonRows(FILE *out, int parent, int depth) {
+  bool first = true;
+  fprintf(out, "[");
+  for (int i = 0; i < record_count; i++) {
+    if (records[i].parent != parent)
+      continue;
+    fprintf(out, "%s\n%*s{\"name\": \"%s\", \"calls\": %zu, \"ms\": %.3f, "
+                 "\"phases\": ",
+            first ? "" : ",", depth * 2 + 4, "", records[i].name,
+            records[i].calls, records[i].total * 1e3);
+    PrintJsonRows(out, i, depth + 1);
+    fprintf(out, "}");
+    first = false;
+  }
+  if (!first)
+    fprintf(out, "\n%*s", depth * 2 + 2, "");
+  fprintf(out, "]");
+}
+
+/**
+ * @brief Print phases and counters in enabled format
+ *
+ * @param out Output stream
+ */
+void PhasesPrint(FILE *out) {
+  if (phase_format == PHASES_TABLE) {
+    double total = PhasesTotal();
+    fprintf(out, "%-32s %8s %12s %8s\n", "phase", "calls", "ms", "share");
+    PrintTableRows(out, -1, 0, total);
+    fprintf(out, "%-32s %8s %12.3f\n", "total", "", total * 1e3);
+    for (int i = 0; i < COUNTER_COUNT; i++)
+      fprintf(out, "%-32s %21zu\n", counter_names[i], phase_counters[i]);
+    fprintf(out, "symtable lookups by groups probed\n");
+    for (int i = 0; i < PROBE_BUCKETS; i++)
+      fprintf(out, "  %d%-29s %21zu\n", i + 1,
+              i + 1 < PROBE_BUCKETS ? "" : "+", probe_lengths[i]);
+  } else if (phase_format == PHASES_JSON) {
+    fprintf(out, "{\n  \"total_ms\": %.3f,\n  \"phases\": ", PhasesTotal() * 1e3);
+    PrintJsonRows(out, -1, 0);
+    fprintf(out, ",\n  \"counters\": {");
+    for (int i = 0; i < COUNTER_COUNT; i++)
+      fprintf(out, "%s\"%s\": %zu", i > 0 ? ", " : "", counter_names[i],
+              phase_counters[i]);
+    fprintf(out, "},\n  \"symtable_probe_lengths\": [");
+    for (int i = 0; i < PROBE_BUCKETS; i++)
+      fprintf(out, "%s%zu", i > 0 ? ", " : "", probe_lengths[i]);
+    fprintf(out, "]\n}\n");
+  }
+}
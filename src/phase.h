@@ -0,0 +1,50 @@
+/**
+ * @file phase.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Timing of compiler phases and work counters header file
+ */
+
+#ifndef PHASE_H
+#define PHASE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define PHASE_MAX 64       // Count of distinct phases
+#define PHASE_DEPTH_MAX 16 // Maximum nesting of phases
+#define PROBE_BUCKETS 8    // Histogram of probe lengths, last bucket is 8+
+
+typedef enum PhaseFormat {
+  PHASES_OFF = 0, // Phases are not timed
+  PHASES_TABLE,   // Aligned table
+  PHASES_JSON     // JSON object
+} PhaseFormat;
+
+typedef enum PhaseCounter {
+  COUNTER_TOKENS = 0,      // Tokens produced by scanner
+  COUNTER_AST_NODES,       // AST nodes created by parser
+  COUNTER_SYMTABLE_PROBES, // Groups of slots visited by symtable lookups
+  COUNTER_INSTRUCTIONS,    // Lines of IFJcode24 emitted by code generator
+  COUNTER_COUNT
+} PhaseCounter;
+
+// Counters are always counted, they are only printed on demand
+extern size_t phase_counters[COUNTER_COUNT];
+
+// Symtable lookups by count of groups they visited, bucket i is i + 1 groups
+extern size_t probe_lengths[PROBE_BUCKETS];
+
+double PhaseNow();
+void PhasesEnable(PhaseFormat format);
+bool PhasesEnabled();
+void PhaseBegin(const char *name);
+void PhaseEnd();
+void PhasesPrint(FILE *out);
+
+#endif
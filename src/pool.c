@@ -0,0 +1,128 @@
+/**
+ * @file pool.c
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Fixed-size object pools source file
+ *
+ * Used for small objects that are created and freed very often
+ * (stack items, tokens, expression items), so they don't go through
+ * malloc and tracking list one by one
+ */
+
+#include "pool.h"
+
+// Pool objects contain only pointers, integers and doubles
+#define POOL_ALIGN(size)                                                       \
+  (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+/**
+ * @brief Freed cell, which is linked to free list
+ */
+struct PoolCell {
+  PoolCell *next;
+};
+
+/**
+ * @brief Block of POOL_SLAB_CELLS cells
+ */
+struct PoolSlab {
+  PoolSlab *next;
+  max_align_t cells[];
+};
+
+// All pools that were used, for statistics
+static Pool *registered_pools = NULL;
+
+/**
+ * @brief Real size of one cell in slab
+ */
+static size_t PoolCellSize(Pool *pool) {
+  size_t size = pool->cell_size;
+  if (size < sizeof(PoolCell))
+    size = sizeof(PoolCell);
+  return POOL_ALIGN(size);
+}
+
+/**
+ * @brief Allocate object from pool
+ *
+ * @param pool Pool
+ *
+ * @return Pointer to allocated object
+ */
+void *PoolAlloc(Pool *pool) {
+  pool->allocs++;
+
+  // Reuse freed cell
+  if (pool->free_list != NULL) {
+    PoolCell *cell = pool->free_list;
+    pool->free_list = cell->next;
+    pool->hits++;
+    return cell;
+  }
+
+  // Newest slab is full
+  if (pool->slab_used == POOL_SLAB_CELLS) {
+    PoolSlab *slab = InvokeAllocNamed(sizeof(PoolSlab) + PoolCellSize(pool) * POOL_SLAB_CELLS, pool->name);
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->slab_used = 0;
+    pool->slab_count++;
+    if (!pool->registered) {
+      pool->registered = true;
+      pool->next = registered_pools;
+      registered_pools = pool;
+    }
+  }
+
+  char *cells = (char *)pool->slabs->cells;
+  return cells + PoolCellSize(pool) * pool->slab_used++;
+}
+
+/**
+ * @brief Give object back to pool
+ *
+ * @param pool Pool that object was allocated from
+ * @param element Pointer to object
+ */
+void PoolFree(Pool *pool, void *element) {
+  if (element == NULL)
+    return;
+  PoolCell *cell = element;
+  cell->next = pool->free_list;
+  pool->free_list = cell;
+  pool->frees++;
+}
+
+/**
+ * @brief Free all slabs of pool, statistics are kept
+ *
+ * @param pool Pool
+ */
+void PoolRelease(Pool *pool) {
+  while (pool->slabs != NULL) {
+    PoolSlab *next = pool->slabs->next;
+    InvokeFree(pool->slabs);
+    pool->slabs = next;
+  }
+  pool->free_list = NULL;
+  pool->slab_used = POOL_SLAB_CELLS;
+}
+
+/**
+ * @brief Print statistics of all used pools
+ *
+ * @param out Output stream
+ */
+void PoolPrintStats(FILE *out) {
+  fprintf(out, "%-12s %6s %10s %10s %7s %6s\n", "pool", "cell", "allocs",
+          "reused", "hit%", "slabs");
+  for (Pool *pool = registered_pools; pool != NULL; pool = pool->next) {
+    double hit_rate = pool->allocs ? 100.0 * pool->hits / pool->allocs : 0.0;
+    fprintf(out, "%-12s %6zu %10zu %10zu %6.1f%% %6zu\n", pool->name,
+            PoolCellSize(pool), pool->allocs, pool->hits, hit_rate,
+            pool->slab_count);
+  }
+}
@@ -0,0 +1,51 @@
+/**
+ * @file pool.h
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Fixed-size object pools header file
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include "error.h"
+#include "memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define POOL_SLAB_CELLS 256 // Count of cells allocated at once
+
+typedef struct PoolCell PoolCell;
+typedef struct PoolSlab PoolSlab;
+
+/**
+ * @brief Pool of objects of the same size
+ * Freed cells are kept in free list and reused by next allocation
+ */
+typedef struct Pool {
+  const char *name;    /**< Name of pool for statistics*/
+  size_t cell_size;    /**< Size of one object*/
+  PoolCell *free_list; /**< Freed cells ready for reuse*/
+  PoolSlab *slabs;     /**< All slabs of pool, newest first*/
+  size_t slab_used;    /**< Count of cells taken from newest slab*/
+  size_t allocs;       /**< Count of all allocations*/
+  size_t hits;         /**< Count of allocations served from free list*/
+  size_t frees;        /**< Count of freed cells*/
+  size_t slab_count;   /**< Count of ever allocated slabs*/
+  struct Pool *next;   /**< Next pool in statistics list*/
+  bool registered;     /**< If pool is already in statistics list*/
+} Pool;
+
+// Static initializer of pool for objects of given type
+#define POOL_INIT(NAME, TYPE)                                                  \
+  { NAME, sizeof(TYPE), NULL, NULL, POOL_SLAB_CELLS, 0, 0, 0, 0, NULL, false }
+
+void *PoolAlloc(Pool *pool);
+void PoolFree(Pool *pool, void *element);
+void PoolRelease(Pool *pool);
+void PoolPrintStats(FILE *out);
+
+#endif
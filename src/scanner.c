@@ -9,115 +9,255 @@
  */
 
 #include "scanner.h"
-
-// Macro for 1 character token
-#define CASE_T(C, T)                                                           \
-  case C:                                                                      \
-    token->type = T;                                                           \
-    return OK
-
-// Macro for changing states
-#define CASE_S(C, S)                                                           \
-  case C:                                                                      \
-    state = S;                                                                 \
-    break
+#include "lexdfa.h"
+#include "scanrun.h"
 
 // File instance
 FILE *file;
 
+/**
+ * Whole source code in one contiguous buffer
+ * Characters are read by moving position, so no stdio call is made per char
+ */
+typedef struct InputBuffer {
+  const unsigned char *data; // Source code
+  size_t length;             // Length of source code
+  size_t pos;                // Position of next character
+  size_t lexeme;             // Start of last lexeme read by GetToken
+  bool mapped;               // Data is mmaped file, otherwise tracked memory
+} InputBuffer;
+
+static InputBuffer input;
+
+#define INPUT_CHUNK 65536
+#define TOKENS_INIT 1024
+#define LEX_CHUNK_MIN 262144 // Smaller chunk is not worth a thread
+#define LEX_THREADS_MAX 16
+
+/**
+ * Tokens of one chunk of input lexed by its own thread
+ * Values are integers or hashes of identifiers
+ */
+typedef struct TokenSegment {
+  InputBuffer in; // Chunk is between in.pos and in.length
+  size_t size;
+  size_t capacity;
+  unsigned char *types;
+  signed char *keywords;
+  uint32_t *offsets;
+  uint32_t *lengths;
+  uint64_t *values; // Wide enough for 64 bit hash
+  int status; // OK, LEXICAL_ERROR or INTERNAL_ERROR
+  pthread_t thread;
+  bool started;       // Thread was created
+  double trace_start; // Time of lexing, for trace
+  double trace_end;
+} TokenSegment;
+
+// Count of lexing threads, 0 means chosen by GenerateTokens
+static size_t lex_threads = 0;
+
 // Scanner instance
 Scanner *scanner;
 
+// Pool of all tokens
+Pool token_pool = POOL_INIT("Token", Token);
+
+// Reusable buffer for identifier or number text, which is converted after it's read
+static String *id_buffer;
+
 /**
- * @brief Get keyword from string
+ * @brief Get empty identifier buffer
  *
- * @param str String to get keyword
- * @return Keyword or K_UNKNOWN
- */
-Keyword GetKeyword(String *str) {
-  if (StringEquals(str, "const"))
-    return K_CONST;
-  if (StringEquals(str, "else"))
-    return K_ELSE;
-  if (StringEquals(str, "fn"))
-    return K_FN;
-  if (StringEquals(str, "if"))
-    return K_IF;
-  if (StringEquals(str, "i32"))
-    return K_I32;
-  if (StringEquals(str, "f64"))
-    return K_F64;
-  if (StringEquals(str, "null"))
-    return K_NULL;
-  if (StringEquals(str, "pub"))
-    return K_PUB;
-  if (StringEquals(str, "return"))
-    return K_RETURN;
-  if (StringEquals(str, "u8"))
-    return K_U8;
-  if (StringEquals(str, "var"))
-    return K_VAR;
-  if (StringEquals(str, "void"))
-    return K_VOID;
-  if (StringEquals(str, "while"))
-    return K_WHILE;
-  if (StringEquals(str, "ifj"))
-    return K_IFJ;
-
-  return K_UNKNOWN;
+ * @return Identifier buffer
+ */
+static String *IdBufferReset() {
+  id_buffer->length = 0;
+  id_buffer->str[0] = '\0';
+  return id_buffer;
 }
 
 /**
- * @brief Get escape code from unprintable char
+ * @brief Load whole file into input buffer
+ * Regular files are mapped into memory, pipes are read by big chunks
  *
- * @param c Char to get escape code
- * @return Escape code or NULL
- */
-char *GetEscapeCode(char c) {
-  if (c >= 1 && c <= 32) {
-    char *escape_str = InvokeAlloc(5 * sizeof(char)); // Allocate space for "\000" format
-    sprintf(escape_str, "\\%03d", c);
-    return escape_str;
+ * @param f File
+ */
+static void InputLoad(FILE *f) {
+  int fd = fileno(f);
+  struct stat st;
+  input.data = NULL;
+  input.length = 0;
+  input.pos = 0;
+  input.mapped = false;
+
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+      lseek(fd, 0, SEEK_CUR) == 0) {
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      input.data = map;
+      input.length = st.st_size;
+      input.mapped = true;
+      return;
+    }
   }
-  return NULL;
+
+  // Pipe, terminal or file which can't be mapped
+  size_t capacity = INPUT_CHUNK;
+  unsigned char *buffer = InvokeAlloc(capacity);
+  while (true) {
+    if (input.length == capacity) {
+      capacity *= 2;
+      buffer = InvokeRealloc(buffer, capacity);
+    }
+    ssize_t count = read(fd, buffer + input.length, capacity - input.length);
+    if (count == 0)
+      break;
+    if (count < 0) {
+      InvokeExit(INTERNAL_ERROR);
+    }
+    input.length += count;
+  }
+  input.data = buffer;
 }
 
 /**
- * @brief Get escape sequence from char
+ * @brief Release input buffer
+ */
+static void InputRelease() {
+  if (input.mapped)
+    munmap((void *)input.data, input.length);
+  else
+    InvokeFree((void *)input.data);
+  input.data = NULL;
+  input.length = 0;
+}
+
+/**
+ * @brief Get value of escaped char (char after backslash)
  *
- * @return Escape sequence or NULL
+ * @param c Char after backslash
+ * @return Value or -1 for unknown escape
  */
-char *GetEscapeSequence() {
-  char c = getc(file);
+static int EscapeValue(int c) {
   switch (c) {
   case '"':
-    return InvokeStrdup("034");
+    return '"';
   case 'n':
-    return InvokeStrdup("010");
+    return '\n';
   case 'r':
-    return InvokeStrdup("013");
+    return '\r';
   case 't':
-    return InvokeStrdup("009");
+    return '\t';
   case '\\':
-    return InvokeStrdup("092");
-  case 'x': {
-    char first = getc(file);
-    char second = getc(file);
-
-    // Check if first and second char is hex
-    if (isxdigit(first) && isxdigit(second)) {
-      char hexStr[3] = {first, second, '\0'};
-      int hexValue = (int)strtol(hexStr, NULL, 16);
-      char *fmtStr = InvokeAlloc(4); // Increased size for decimal ASCII
-      sprintf(fmtStr, "%03d", hexValue);
-      return fmtStr;
-    } else {
-      return NULL;
+    return '\\';
+  default:
+    return -1;
+  }
+}
+
+/**
+ * @brief Get value of hexadecimal digit
+ *
+ * @return Value or -1 if char isn't hexadecimal digit
+ */
+static int HexValue(int c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+    return (c | 0x20) - 'a' + 10;
+  return -1;
+}
+
+/**
+ * @brief Copy lexeme to identifier buffer, so it's null terminated
+ *
+ * @param lexeme Start of lexeme in input
+ * @param length Length of lexeme
+ * @return Identifier buffer
+ */
+static String *ScratchFill(const char *lexeme, size_t length) {
+  String *str = IdBufferReset();
+  PushSlice(str, lexeme, length);
+  return str;
+}
+
+// Largest power of 10 that double holds exactly
+#define EXACT_POWER_MAX 22
+
+// Mantissa up to 2^53 is exact in double
+#define EXACT_MANTISSA_MAX (1ULL << 53)
+
+// Mantissa with up to 19 digits fits to 64 bits
+#define MANTISSA_DIGITS_MAX 19
+
+static const double exact_powers[EXACT_POWER_MAX + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * @brief Convert integer literal, digits are accumulated directly
+ *
+ * @param s Digits of literal
+ * @param length Count of digits
+ * @param value Value of literal
+ * @return OK or LEXICAL_ERROR if literal doesn't fit to i32
+ */
+static int ParseInteger(const char *s, size_t length, int *value) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < length; i++) {
+    result = result * 10 + (s[i] - '0');
+    if (result > INT32_MAX)
+      return LEXICAL_ERROR;
+  }
+  *value = (int)result;
+  return OK;
+}
+
+/**
+ * @brief Convert float literal
+ * When both mantissa and power of 10 are exact in double, one multiplication
+ * or division gives correctly rounded value. Other literals use strtod
+ *
+ * @param s Float literal checked by automaton
+ * @param length Length of literal
+ * @return Value of literal
+ */
+static double ParseFloat(const char *s, size_t length) {
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int exponent = 0;
+  size_t i = 0;
+
+  for (; i < length && isdigit((unsigned char)s[i]); i++, digits++)
+    mantissa = mantissa * 10 + (s[i] - '0');
+  if (i < length && s[i] == '.') {
+    for (i++; i < length && isdigit((unsigned char)s[i]); i++, digits++) {
+      mantissa = mantissa * 10 + (s[i] - '0');
+      exponent--;
     }
   }
-  default:
-    return NULL;
+  if (i < length && (s[i] == 'e' || s[i] == 'E')) {
+    i++;
+    bool negative = s[i] == '-';
+    if (s[i] == '+' || s[i] == '-')
+      i++;
+    int value = 0;
+    for (; i < length; i++) {
+      // Bigger exponents don't fit to double anyway
+      if (value < 100000)
+        value = value * 10 + (s[i] - '0');
+    }
+    exponent += negative ? -value : value;
+  }
+
+  if (digits <= MANTISSA_DIGITS_MAX && mantissa <= EXACT_MANTISSA_MAX &&
+      exponent >= -EXACT_POWER_MAX && exponent <= EXACT_POWER_MAX) {
+    double value = (double)mantissa;
+    return exponent < 0 ? value / exact_powers[-exponent]
+                        : value * exact_powers[exponent];
   }
+  return strtod(ScratchFill(s, length)->str, NULL);
 }
 
 /**
@@ -127,404 +267,642 @@ char *GetEscapeSequence() {
  */
 void ScannerInit(FILE *f) {
   file = f;
+  InputLoad(f);
+  ScanRunInit();
   scanner = InvokeAlloc(sizeof(Scanner));
-  scanner->size = 0;
-  scanner->capacity = 100;
-  scanner->tokens = InvokeAlloc(sizeof(Token *) * scanner->capacity);
-  scanner->current_token = 0;
+  memset(scanner, 0, sizeof(Scanner));
+  id_buffer = StringNew();
 }
 
 /**
  * @brief Free all tokens and destroy scanner
  */
 void ScannerDestroy() {
+  InputRelease();
   if (file != stdin) {
     fclose(file);
   }
 
-  Token *token = NULL;
-  // Free all tokens
-  for (size_t i = 0; i < scanner->size; i++) {
-    token = scanner->tokens[i];
-    // Because of union type it value.string always will be not NULL
-    // So we must check like this to free string
-    if ((token->type == T_ID && token->keyword == K_UNKNOWN) ||
-        token->type == T_STR) {
-      FreeString(token->value.string);
+  // Free all strings at once
+  PoolRelease(&token_pool);
+  ArenaRelease(ARENA_SCANNER);
+
+  InvokeFree(scanner->types);
+  InvokeFree(scanner->keywords);
+  InvokeFree(scanner->offsets);
+  InvokeFree(scanner->lengths);
+  InvokeFree(scanner->values);
+  InvokeFree(scanner->reals);
+  InvokeFree(scanner->strings);
+  InvokeFree(scanner);
+}
+
+/**
+ * @brief Decode content of string literal, escape sequences are replaced
+ * by chars they stand for. Value is never longer than content, so it's
+ * written directly to string without any allocation per escape
+ *
+ * @param str Output string
+ * @param s Content between quotes
+ * @param length Length of content
+ * @return OK or LEXICAL_ERROR for invalid escape sequence
+ */
+static int DecodeString(String *str, const char *s, size_t length) {
+  char *begin = StringExtend(str, length);
+  char *out = begin;
+  size_t i = 0;
+  while (i < length) {
+    // Copy run of chars without escape at once
+    const char *escape = memchr(s + i, '\\', length - i);
+    size_t run = escape == NULL ? length - i : (size_t)(escape - (s + i));
+    memcpy(out, s + i, run);
+    out += run;
+    if ((i += run) == length)
+      break;
+
+    if (i + 1 == length)
+      return LEXICAL_ERROR;
+    int value;
+    if (s[i + 1] == 'x') {
+      if (i + 3 >= length || HexValue(s[i + 2]) < 0 || HexValue(s[i + 3]) < 0)
+        return LEXICAL_ERROR;
+      value = HexValue(s[i + 2]) * 16 + HexValue(s[i + 3]);
+      i += 4;
+    } else {
+      if ((value = EscapeValue(s[i + 1])) < 0)
+        return LEXICAL_ERROR;
+      i += 2;
+    }
+    *out++ = value;
+  }
+  str->length -= length - (out - begin);
+  str->str[str->length] = '\0';
+  return OK;
+}
+
+/**
+ * @brief Decode multiline string literal
+ * Lines are joined by new line, whitespace between lines is skipped
+ *
+ * @param str Output string
+ * @param s Lexeme starting with first \\
+ * @param length Length of lexeme
+ */
+static void DecodeMultiline(String *str, const char *s, size_t length) {
+  char *begin = StringExtend(str, length);
+  char *out = begin;
+  for (size_t i = 0; i < length && s[i] == '\\';) {
+    // New line before every line except the first one
+    if (i > 0)
+      *out++ = '\n';
+    i += 2;
+    const char *end = memchr(s + i, '\n', length - i);
+    size_t line = end == NULL ? length - i : (size_t)(end - (s + i));
+    memcpy(out, s + i, line);
+    out += line;
+    i += line;
+    while (i < length && isspace((unsigned char)s[i]))
+      i++;
+  }
+  str->length -= length - (out - begin);
+  str->str[str->length] = '\0';
+}
+
+/**
+ * @brief Make string token from lexeme of string literal
+ *
+ * @param token Token to fill
+ * @param lexeme Lexeme with quotes or with \\ of every line
+ * @param length Length of lexeme
+ * @return OK or LEXICAL_ERROR for invalid escape sequence
+ */
+static int MakeString(Token *token, const char *lexeme, size_t length) {
+  String *str = StringNew();
+  if (lexeme[0] == '"') {
+    if (DecodeString(str, lexeme + 1, length - 2) != OK) {
+      FreeString(str);
+      return LEXICAL_ERROR;
     }
-    InvokeFree(token);
+  } else {
+    DecodeMultiline(str, lexeme, length);
   }
+  token->type = T_STR;
+  token->value.string = str;
+  return OK;
+}
 
-  InvokeFree(scanner->tokens);
-  InvokeFree(scanner);
+/**
+ * @brief Walk input through lexdfa tables until there is no transition
+ * Only buffer is touched, so chunks of input can be scanned in parallel
+ *
+ * @param in Input, lexeme and pos are set to the found lexeme
+ * @return Accept action of the last state (TokenType, DFA_REJECT, DFA_SINGLE)
+ */
+static int ScanLexeme(InputBuffer *in) {
+  const unsigned char *data = in->data;
+  size_t pos = in->pos;
+  size_t start = pos;
+  unsigned char state = D_START;
+  while (true) {
+    unsigned char cls = pos < in->length ? char_class[data[pos]] : C_EOF;
+    unsigned char next = dfa_next[state][cls];
+    if (next == D_STOP)
+      break;
+    state = next;
+    // End of input is never consumed
+    if (cls != C_EOF)
+      pos++;
+
+    // Runs are skipped at once, they end where automaton leaves state.
+    // Kernel is called only when run continues, most runs are 1 char long
+    switch (state) {
+    case D_START:
+      if (pos < in->length &&
+          dfa_next[D_START][char_class[data[pos]]] == D_START)
+        pos += scan_run.whitespace(data + pos, in->length - pos);
+      // Whitespace and comments are not part of token
+      start = pos;
+      break;
+    case D_COMMENT:
+      pos += scan_run.line(data + pos, in->length - pos);
+      break;
+    case D_ID:
+      if (pos < in->length &&
+          dfa_next[D_ID][char_class[data[pos]]] == D_ID)
+        pos += scan_run.ident(data + pos, in->length - pos);
+      break;
+    default:
+      break;
+    }
+  }
+  in->pos = pos;
+  in->lexeme = start;
+  return dfa_accept[state];
 }
 
 /**
  * @brief Get the next token from the input file
+ * Table-driven automaton: input is walked through lexdfa tables until there is
+ * no transition, then value of token is made from lexeme
  *
  * @param token Pointer to the token structure to store the result
  * @return Status code (OK or LEXICAL_ERROR)
  */
 int GetToken(Token *token) {
-  char c;
-  String *str = NULL;
   token->value.string = NULL;
   token->keyword = K_UNKNOWN;
-  State state = S_START;
 
-  // Main scanner loop
-  do {
-    c = getc(file);
-    switch (state) {
-    case S_START:
-      if (isspace(c)) {
-        continue;
-      }
-      switch (c) {
-        CASE_T(EOF, T_EOF);
-        CASE_T('.', T_DOT);
-        CASE_T(';', T_SEMICOLON);
-        CASE_T(':', T_COLON);
-        CASE_T(',', T_COMMA);
-        CASE_T('(', T_OPAREN);
-        CASE_T(')', T_CPAREN);
-        CASE_T('[', T_OSQUARE);
-        CASE_T(']', T_CSQUARE);
-        CASE_T('{', T_OCURLY);
-        CASE_T('}', T_CCURLY);
-        CASE_T('|', T_PIPE);
-        CASE_T('@', T_AT);
-        CASE_T('?', T_QUESTM);
-        CASE_T('+', T_PLUS);
-        CASE_T('-', T_SUB);
-        CASE_T('*', T_MUL);
-
-        CASE_S('>', S_GT);
-        CASE_S('<', S_LT);
-        CASE_S('=', S_EQ);
-        CASE_S('!', S_NEQ);
-        CASE_S('/', S_DIV);
-      case '"': {
-        str = StringNew();
-        state = S_STR;
-        break;
-      }
-      case '\\': {
-        str = StringNew();
-        state = S_MLSTR;
-        break;
-      }
-
-      case '0': {
-        str = StringNew();
-        PushChar(str, c);
-        state = S_INT0;
-        break;
-      }
+  int action = ScanLexeme(&input);
+  const char *lexeme = (const char *)input.data + input.lexeme;
+  size_t length = input.pos - input.lexeme;
+  switch (action) {
+  case DFA_REJECT:
+    return LEXICAL_ERROR;
+  case DFA_SINGLE:
+    token->type = single_token[(unsigned char)lexeme[0]];
+    return OK;
+  case T_ID: {
+    token->type = T_ID;
+    token->keyword = KeywordLookup(lexeme, length);
+    if (token->keyword == K_UNKNOWN)
+      token->value.atom = AtomIntern(lexeme, length);
+    return OK;
+  }
+  case T_INT:
+    token->type = T_INT;
+    return ParseInteger(lexeme, length, &token->value.integer);
+  case T_FLOAT:
+    token->type = T_FLOAT;
+    token->value.real = ParseFloat(lexeme, length);
+    return OK;
+  case T_STR:
+    return MakeString(token, lexeme, length);
+  default:
+    token->type = action;
+    return OK;
+  }
+}
 
-      case '1' ... '9': {
-        str = StringNew();
-        PushChar(str, c);
-        state = S_INT1;
-        break;
-      }
+/**
+ * @brief Move scanner back to the start of input and drop generated tokens
+ */
+void ScannerRewind() {
+  input.pos = 0;
+  scanner->size = 0;
+  scanner->reals_size = 0;
+  scanner->strings_size = 0;
+}
 
-      case '_': {
-        str = StringNew();
-        PushChar(str, c);
-        state = S_UNDERSCORE;
-        break;
-      }
+/**
+ * @brief Double capacity of token arrays
+ */
+static void TokensGrow() {
+  size_t capacity = scanner->capacity == 0 ? TOKENS_INIT : scanner->capacity * 2;
+  scanner->capacity = capacity;
+  scanner->types = InvokeRealloc(scanner->types, capacity);
+  scanner->keywords = InvokeRealloc(scanner->keywords, capacity);
+  scanner->offsets =
+      InvokeRealloc(scanner->offsets, sizeof(uint32_t) * capacity);
+  scanner->lengths =
+      InvokeRealloc(scanner->lengths, sizeof(uint32_t) * capacity);
+  scanner->values =
+      InvokeRealloc(scanner->values, sizeof(uint32_t) * capacity);
+}
 
-      case 'a' ... 'z':
-      case 'A' ... 'Z':
-        str = StringNew();
-        PushChar(str, c);
-        state = S_ID;
-        break;
+/**
+ * @brief Append token to token arrays
+ *
+ * @param token Token read by GetToken
+ * @param offset Start of lexeme in input
+ * @param length Length of lexeme
+ */
+static void TokensPush(Token *token, size_t offset, size_t length) {
+  if (scanner->size == scanner->capacity)
+    TokensGrow();
+  size_t i = scanner->size++;
+  scanner->types[i] = token->type;
+  scanner->keywords[i] = token->keyword;
+  scanner->offsets[i] = offset;
+  scanner->lengths[i] = length;
+  scanner->values[i] = 0;
 
-      default:
-        return LEXICAL_ERROR;
-      }
-      break;
-    case S_UNDERSCORE:
-      // If char is alphanumeric or underscore
-      if (isalnum(c) || c == '_') {
-        PushChar(str, c);
-        state = S_ID;
-      // Else return underscore token
-      } else {
-        ungetc(c, file);
-        token->type = T_UNDERSCORE;
-        FreeString(str);
-        return OK;
-      }
-      break;
-    case S_ID: {
-      if (isalnum(c) || c == '_') {
-        PushChar(str, c);
-      } else {
-        ungetc(c, file);
-        Keyword keyword = GetKeyword(str);
-        if (keyword != K_UNKNOWN) {
-          token->type = T_ID;
-          token->keyword = keyword;
-          FreeString(str);
-        } else {
-          token->type = T_ID;
-          token->value.string = str;
-        }
-        return OK;
-      }
-      break;
+  switch (token->type) {
+  case T_ID:
+    if (token->keyword == K_UNKNOWN)
+      scanner->values[i] = token->value.atom->id;
+    break;
+  case T_INT:
+    scanner->values[i] = (uint32_t)token->value.integer;
+    break;
+  case T_FLOAT:
+    if (scanner->reals_size == scanner->reals_capacity) {
+      scanner->reals_capacity = scanner->reals_size * 2 + TOKENS_INIT;
+      scanner->reals = InvokeRealloc(scanner->reals, sizeof(double) *
+                                                         scanner->reals_capacity);
     }
-    case S_INT0: {
-      if (c == '.') {
-        PushChar(str, c);
-        state = S_DOT;
-      } else if (c == 'e' || c == 'E') {
-        PushChar(str, c);
-        state = S_EXP;
-      } else if (c >= '0' && c <= '9') {
-        FreeString(str);
-        return LEXICAL_ERROR;
-      } else {
-        ungetc(c, file);
-        token->type = T_INT;
-        token->value.integer = atoi(str->str);
-        FreeString(str);
-        return OK;
-      }
-      break;
+    scanner->values[i] = scanner->reals_size;
+    scanner->reals[scanner->reals_size++] = token->value.real;
+    break;
+  case T_STR:
+    if (scanner->strings_size == scanner->strings_capacity) {
+      scanner->strings_capacity = scanner->strings_size * 2 + TOKENS_INIT;
+      scanner->strings = InvokeRealloc(
+          scanner->strings, sizeof(String *) * scanner->strings_capacity);
     }
-    case S_INT1: {
-      if (c >= '0' && c <= '9') {
-        PushChar(str, c);
-      } else if (c == '.') {
-        PushChar(str, c);
-        state = S_DOT;
-      } else if (c == 'e' || c == 'E') {
-        PushChar(str, c);
-        state = S_EXP;
-      } else {
-        ungetc(c, file);
-        token->type = T_INT;
-        token->value.integer = atoi(str->str);
-        FreeString(str);
-        return OK;
-      }
-      break;
+    scanner->values[i] = scanner->strings_size;
+    scanner->strings[scanner->strings_size++] = token->value.string;
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief Lex whole input serially with GetToken
+ */
+static void GenerateTokensSerial() {
+  double trace_start = TraceStart();
+  Token token;
+  do {
+    if (GetToken(&token) != OK) {
+      InvokeExit(LEXICAL_ERROR);
     }
-    case S_DOT: {
-      if (c >= '0' && c <= '9') {
-        PushChar(str, c);
-        state = S_FLOAT_D;
-      } else {
-        FreeString(str);
-        return LEXICAL_ERROR;
-      }
-      break;
+    TokensPush(&token, input.lexeme, input.pos - input.lexeme);
+  } while (token.type != T_EOF);
+  TraceSpan("GenerateTokensSerial", trace_start, 0, scanner->size - 1);
+}
+
+/**
+ * @brief Set count of threads used by GenerateTokens
+ *
+ * @param threads Count of threads, 0 chooses it by size of input and CPUs,
+ * other values force it even for small inputs
+ */
+void ScannerSetThreads(size_t threads) { lex_threads = threads; }
+
+/**
+ * @brief Find safe start of chunk, so lexeme can't continue over it
+ * It's the first character of line that is not whitespace and not \\ of
+ * multiline string, neither string literal nor comment crosses new line
+ *
+ * @param from Position where search starts
+ * @param limit Split has to be before limit
+ * @return Position of split or 0 if there is none
+ */
+static size_t FindSplit(size_t from, size_t limit) {
+  const unsigned char *data = input.data;
+  size_t pos = from;
+  while (pos < limit) {
+    const unsigned char *nl = memchr(data + pos, '\n', limit - pos);
+    if (nl == NULL)
+      return 0;
+    pos = nl - data + 1;
+    pos += scan_run.whitespace(data + pos, input.length - pos);
+    if (pos < limit && data[pos] != '\\')
+      return pos;
+  }
+  return 0;
+}
+
+/**
+ * @brief Make segment arrays bigger, segments use malloc, because
+ * tracked allocations are not thread safe
+ *
+ * @return false if memory can't be allocated
+ */
+static bool SegmentGrow(TokenSegment *seg) {
+  size_t capacity = seg->capacity == 0 ? TOKENS_INIT : seg->capacity * 2;
+  unsigned char *types = realloc(seg->types, capacity);
+  if (types != NULL)
+    seg->types = types;
+  signed char *keywords = realloc(seg->keywords, capacity);
+  if (keywords != NULL)
+    seg->keywords = keywords;
+  uint32_t *offsets = realloc(seg->offsets, sizeof(uint32_t) * capacity);
+  if (offsets != NULL)
+    seg->offsets = offsets;
+  uint32_t *lengths = realloc(seg->lengths, sizeof(uint32_t) * capacity);
+  if (lengths != NULL)
+    seg->lengths = lengths;
+  uint64_t *values = realloc(seg->values, sizeof(uint64_t) * capacity);
+  if (values != NULL)
+    seg->values = values;
+  if (!types || !keywords || !offsets || !lengths || !values)
+    return false;
+  seg->capacity = capacity;
+  return true;
+}
+
+/**
+ * @brief Lex chunk to its segment
+ * Only thread safe work is done: atoms, floats and strings are made
+ * later by StitchSegments, identifiers get only their hash
+ *
+ * @param seg Segment of chunk, result is in its status
+ */
+static void LexChunkTokens(TokenSegment *seg) {
+  seg->status = OK;
+  while (true) {
+    int action = ScanLexeme(&seg->in);
+    // End of chunk, EOF token is added after all segments
+    if (action == T_EOF)
+      return;
+    if (action == DFA_REJECT) {
+      seg->status = LEXICAL_ERROR;
+      return;
     }
-    case S_FLOAT_D:
-      if (c >= '0' && c <= '9') {
-        PushChar(str, c);
-      } else {
-        if (c == 'e' || c == 'E') {
-            PushChar(str, c);
-            state = S_EXP;
-        } else {
-            ungetc(c, file);
-            token->type = T_FLOAT;
-            token->value.real = atof(str->str);
-            FreeString(str);
-            return OK;
-        }
-      }
+    if (seg->size == seg->capacity && !SegmentGrow(seg)) {
+      seg->status = INTERNAL_ERROR;
+      return;
+    }
+
+    size_t i = seg->size++;
+    const char *lexeme = (const char *)seg->in.data + seg->in.lexeme;
+    size_t length = seg->in.pos - seg->in.lexeme;
+    seg->types[i] = action;
+    seg->keywords[i] = K_UNKNOWN;
+    seg->offsets[i] = seg->in.lexeme;
+    seg->lengths[i] = length;
+    seg->values[i] = 0;
+    switch (action) {
+    case DFA_SINGLE:
+      seg->types[i] = single_token[(unsigned char)lexeme[0]];
       break;
-    case S_EXP: {
-      if (c == '+' || c == '-') {
-        PushChar(str, c);
-        state = S_EXPS;
-      } else if (c >= '1' && c <= '9') {
-        PushChar(str, c);
-        state = S_FLOAT_E;
-      } else {
-        FreeString(str);
-        return LEXICAL_ERROR;
-      }
+    case T_ID:
+      seg->keywords[i] = KeywordLookup(lexeme, length);
+      if (seg->keywords[i] == K_UNKNOWN)
+        seg->values[i] = AtomHash(lexeme, length);
       break;
-    }
-    case S_EXPS: {
-      if (c >= '1' && c <= '9') {
-        PushChar(str, c);
-        state = S_FLOAT_E;
-      } else {
-        FreeString(str);
-        return LEXICAL_ERROR;
+    case T_INT: {
+      int value;
+      if (ParseInteger(lexeme, length, &value) != OK) {
+        seg->status = LEXICAL_ERROR;
+        return;
       }
+      seg->values[i] = (uint32_t)value;
       break;
     }
-    case S_FLOAT_E: {
-      if (c >= '0' && c <= '9') {
-        PushChar(str, c);
-      } else {
-        ungetc(c, file);
-        token->type = T_FLOAT;
-        token->value.real = atof(str->str);
-        FreeString(str);
-        return OK;
-      }
+    default:
       break;
     }
-    case S_GT:
-      if (c == '=') {
-        token->type = T_GEQ;
-        return OK;
-      } else {
-        ungetc(c, file);
-        token->type = T_GT;
-        return OK;
-      }
-    case S_LT:
-      if (c == '=') {
-        token->type = T_LEQ;
-        return OK;
-      } else {
-        ungetc(c, file);
-        token->type = T_LT;
-        return OK;
-      }
-    case S_EQ:
-      if (c == '=') {
-        token->type = T_EQ;
-        return OK;
-      } else {
-        ungetc(c, file);
-        token->type = T_ASSIGN;
-        return OK;
-      }
-    case S_NEQ:
-      if (c == '=') {
-        token->type = T_NEQ;
-        return OK;
-      } else {
-        ungetc(c, file);
-        return LEXICAL_ERROR;
-      }
-    case S_DIV: {
-      if (c == '/') {
-
-        c = getc(file);
-        while (c != '\n' && c != EOF) {
-          c = getc(file);
-        }
-
-        if (c == '\n') {
-          ungetc(c, file);
-        }
-        state = S_START;
+  }
+}
+
+/**
+ * @brief Thread of one chunk
+ *
+ * @param arg TokenSegment of chunk
+ * @return NULL, result is in status of segment
+ */
+static void *LexChunk(void *arg) {
+  TokenSegment *seg = arg;
+  seg->trace_start = TraceStart();
+  LexChunkTokens(seg);
+  seg->trace_end = TraceStart();
+  return NULL;
+}
+
+/**
+ * @brief Write spans of chunks to trace, chunk lexed on main thread is on
+ * thread 0
+ */
+static void TraceSegments(TokenSegment *segments, size_t count) {
+  size_t first = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t size = segments[i].size;
+    TraceEvent("LexChunk", segments[i].started ? (int)i : 0,
+               segments[i].trace_start, segments[i].trace_end,
+               size > 0 ? first : TRACE_NO_TOKENS, first + size - 1);
+    first += size;
+  }
+}
+
+/**
+ * @brief Free arrays of segments
+ */
+static void SegmentsFree(TokenSegment *segments, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    free(segments[i].types);
+    free(segments[i].keywords);
+    free(segments[i].offsets);
+    free(segments[i].lengths);
+    free(segments[i].values);
+  }
+}
+
+/**
+ * @brief Append tokens of all segments in order to token arrays
+ * Atoms are interned in the same order as by serial scanner, so their ids match
+ *
+ * @return OK or LEXICAL_ERROR for invalid escape sequence
+ */
+static int StitchSegments(TokenSegment *segments, size_t count) {
+  for (size_t s = 0; s < count; s++) {
+    TokenSegment *seg = &segments[s];
+    for (size_t i = 0; i < seg->size; i++) {
+      const char *lexeme = (const char *)input.data + seg->offsets[i];
+      size_t length = seg->lengths[i];
+      Token token = {.type = seg->types[i], .keyword = seg->keywords[i]};
+      token.value.string = NULL;
+      switch (token.type) {
+      case T_ID:
+        if (token.keyword == K_UNKNOWN)
+          token.value.atom = AtomInternHashed(lexeme, length, seg->values[i]);
         break;
-      } else {
-        ungetc(c, file);
-        token->type = T_DIV;
-        return OK;
-      }
-    }
-    case S_STR: {
-      if (c == '\n') {
-        return LEXICAL_ERROR;
-      } else if (c == '"') {
-        token->type = T_STR;
-        token->value.string = str;
-        token->keyword = K_UNKNOWN;
-        return OK;
-      } else if (c == '\\') {
-        char *escape_char = GetEscapeSequence();
-        if (escape_char != NULL) {
-          PushChar(str, '\\');
-          PushString(str, escape_char);
-        } else {
+      case T_INT:
+        token.value.integer = (int)seg->values[i];
+        break;
+      case T_FLOAT:
+        token.value.real = ParseFloat(lexeme, length);
+        break;
+      case T_STR:
+        if (MakeString(&token, lexeme, length) != OK)
           return LEXICAL_ERROR;
-        }
-      } else if (c == ' ') {
-        PushString(str, "\\032");
-      } else {
-        PushChar(str, c);
+        break;
+      default:
+        break;
       }
-      break;
+      TokensPush(&token, seg->offsets[i], length);
     }
+  }
+  Token eof = {.type = T_EOF, .keyword = K_UNKNOWN};
+  eof.value.string = NULL;
+  TokensPush(&eof, input.length, 0);
+  return OK;
+}
 
-    case S_MLSTR: {
-      if (c == '\\') {
-        c = getc(file);
-        if (c != '\n') {
-          while (c != EOF && c != '\n') {
-            if (c == '\\') {
-              PushString(str, "\\092");
-            } else if (c >= 0 && c <= 32) {
-              PushString(str, GetEscapeCode(c));
-            } else {
-              PushChar(str, c);
-            }
-            c = getc(file);
-          }
-        }
-        PushString(str, "\\010");
-      } else {
-        return LEXICAL_ERROR;
-      }
+/**
+ * @brief Lex chunks of input on threads and stitch their tokens together
+ *
+ * @return false if input can't be split, then it has to be lexed serially
+ */
+static bool GenerateTokensParallel() {
+  size_t threads = lex_threads;
+  if (threads == 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = cpus > 0 ? (size_t)cpus : 1;
+    if (threads > input.length / LEX_CHUNK_MIN)
+      threads = input.length / LEX_CHUNK_MIN;
+  }
+  if (threads > LEX_THREADS_MAX)
+    threads = LEX_THREADS_MAX;
+  if (threads > input.length)
+    threads = input.length;
+  if (threads < 2)
+    return false;
 
-      while (true) {
-        c = getc(file);
-        if (isspace(c)) {
-          continue;
-        } else if (c == '\\') {
-          break;
-        } else {
-          size_t len = strlen(str->str);
-          if (len >= 4 && strcmp(&str->str[len - 4], "\\010") == 0) {
-            str->str[len - 4] = '\0';
-            str->length -= 4;
-          }
-          ungetc(c, file);
-          token->type = T_STR;
-          token->value.string = str;
-          token->keyword = K_UNKNOWN;
-          return OK;
-        }
-      }
-      break;
-    }
-    default:
-      return LEXICAL_ERROR;
+  // Chunk i ends at the first safe split after i/threads of input,
+  // part without split is joined to the next chunk
+  TokenSegment segments[LEX_THREADS_MAX];
+  size_t count = 0;
+  size_t begin = 0;
+  for (size_t i = 1; i <= threads; i++) {
+    size_t end = input.length;
+    if (i < threads) {
+      end = FindSplit(input.length * i / threads,
+                      input.length * (i + 1) / threads);
+      if (end == 0)
+        continue;
     }
-  } while (c != EOF);
-  return 0;
+    memset(&segments[count], 0, sizeof(TokenSegment));
+    segments[count].in.data = input.data;
+    segments[count].in.length = end;
+    segments[count].in.pos = begin;
+    segments[count].in.lexeme = begin;
+    count++;
+    begin = end;
+  }
+  if (count < 2)
+    return false;
+
+  // The first chunk is lexed by this thread, chunk without thread too
+  for (size_t i = 1; i < count; i++) {
+    segments[i].started =
+        pthread_create(&segments[i].thread, NULL, LexChunk, &segments[i]) == 0;
+  }
+  LexChunk(&segments[0]);
+  for (size_t i = 1; i < count; i++) {
+    if (segments[i].started)
+      pthread_join(segments[i].thread, NULL);
+    else
+      LexChunk(&segments[i]);
+  }
+
+  // The first error in input is reported, as by serial scanner
+  int status = OK;
+  for (size_t i = 0; i < count && status == OK; i++)
+    status = segments[i].status;
+  if (status == OK) {
+    double trace_start = TraceStart();
+    status = StitchSegments(segments, count);
+    TraceSpan("StitchSegments", trace_start, 0, scanner->size - 1);
+    TraceSegments(segments, count);
+  }
+  SegmentsFree(segments, count);
+  if (status != OK)
+    InvokeExit(status);
+  return true;
 }
 
 /**
  * @brief Generates token array from the input stream.
+ * Large input is split to chunks lexed in parallel, tokens are the same
+ * as from serial scanner
  */
 void GenerateTokens() {
-  Token *token = NULL;
-  // Token read
-  while (true) {
-    token = InvokeAlloc(sizeof(Token));
+  // Offsets and lengths of lexemes are 32 bit
+  if (input.length > UINT32_MAX)
+    InvokeExit(INTERNAL_ERROR);
+
+  if (!GenerateTokensParallel())
+    GenerateTokensSerial();
+  scanner->current_token = 0;
+  phase_counters[COUNTER_TOKENS] += scanner->size;
+}
+
+/**
+ * @brief Get token from token arrays
+ *
+ * @param index Index of token
+ * @param token Token to fill, tokens after the last one are EOF
+ */
+void ScannerGetToken(size_t index, Token *token) {
+  if (index >= scanner->size) {
+    token->type = T_EOF;
+    token->keyword = K_UNKNOWN;
     token->value.string = NULL;
-    if (GetToken(token) != 0) {
-      InvokeExit(LEXICAL_ERROR);
-    }
-    scanner->tokens[scanner->size] = token;
-    scanner->size += 1;
-    // Reallocate memory if needed
-    if (scanner->size == scanner->capacity - 2) {
-      scanner->capacity += 100;
-      scanner->tokens =
-          InvokeRealloc(scanner->tokens, sizeof(Token *) * scanner->capacity);
-    }
-    if (token->type == T_EOF)
-      break;
-    token = NULL;
+    return;
   }
-  scanner->current_token = 0;
+  token->type = scanner->types[index];
+  token->keyword = scanner->keywords[index];
+  uint32_t value = scanner->values[index];
+  switch (token->type) {
+  case T_ID:
+    token->value.atom = token->keyword == K_UNKNOWN ? AtomById(value) : NULL;
+    break;
+  case T_INT:
+    token->value.integer = (int32_t)value;
+    break;
+  case T_FLOAT:
+    token->value.real = scanner->reals[value];
+    break;
+  case T_STR:
+    token->value.string = scanner->strings[value];
+    break;
+  default:
+    token->value.string = NULL;
+    break;
+  }
+}
+
+/**
+ * @brief Get source text of token, it points to the input buffer
+ *
+ * @param index Index of token
+ * @param length Length of text
+ * @return Start of text, it's not null terminated
+ */
+const char *ScannerLexeme(size_t index, size_t *length) {
+  *length = scanner->lengths[index];
+  return (const char *)input.data + scanner->offsets[index];
 }
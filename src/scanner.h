@@ -11,11 +11,22 @@
 #ifndef SCANNER_H
 #define SCANNER_H
 
+#include "arena.h"
+#include "atom.h"
 #include "error.h"
 #include "jm_string.h"
+#include "keyword.h"
 #include "memory.h"
+#include "phase.h"
+#include "pool.h"
+#include "trace.h"
 #include <ctype.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 typedef enum TokenType {
   T_EOF = 0,   // end of file
@@ -52,47 +63,9 @@ typedef enum TokenType {
   T_UNDERSCORE // _
 } TokenType;
 
-typedef enum State {
-  S_ERR = -1,
-  S_START,
-  S_LT,
-  S_GT,
-  S_EQ,
-  S_NEQ,
-  S_DIV,
-  S_INT0,
-  S_INT1,
-  S_DOT,
-  S_FLOAT_E,
-  S_FLOAT_D,
-  S_EXPS,
-  S_EXP,
-  S_STR,
-  S_MLSTR,
-  S_ID,
-  S_UNDERSCORE
-} State;
-
-typedef enum Keyword {
-  K_UNKNOWN = -1,
-  K_CONST = 0,
-  K_ELSE,
-  K_FN,
-  K_IF,
-  K_I32,
-  K_F64,
-  K_NULL,
-  K_PUB,
-  K_RETURN,
-  K_U8,
-  K_VAR,
-  K_VOID,
-  K_WHILE,
-  K_IFJ,
-} Keyword;
-
 typedef union TokenValue {
-  String *string;
+  String *string; // string literal
+  Atom *atom;     // identifier
   int integer;
   double real;
 } TokenValue;
@@ -104,24 +77,37 @@ typedef struct Token {
 } Token;
 
 /**
- * Scanner structure that will contain array of tokens
- * Which will be used in parser
+ * Scanner structure that will contain tokens as parallel arrays
+ * Which will be used in parser (through ScannerGetToken)
  */
 typedef struct Scanner {
   size_t size;
   size_t capacity;
-  size_t current_token; //Current index in token array
-  Token **tokens;
+  size_t current_token; //Current index in token arrays
+  unsigned char *types;  // TokenType of token
+  signed char *keywords; // Keyword of token
+  uint32_t *offsets;     // Start of lexeme in input
+  uint32_t *lengths;     // Length of lexeme
+  uint32_t *values;      // Integer, atom id or index to reals/strings
+  double *reals;         // Values of float literals
+  size_t reals_size;
+  size_t reals_capacity;
+  String **strings;      // Values of string literals
+  size_t strings_size;
+  size_t strings_capacity;
 } Scanner;
 
 extern Scanner *scanner;
+extern Pool token_pool;
 
 void ScannerInit(FILE *f);
 
-Keyword GetKeyword(String *str);
-char *GetEscapeSequence();
 int GetToken(Token *token);
+void ScannerRewind();
+void ScannerSetThreads(size_t threads);
 void ScannerDestroy();
 void GenerateTokens();
+void ScannerGetToken(size_t index, Token *token);
+const char *ScannerLexeme(size_t index, size_t *length);
 
 #endif // SCANNER_H
@@ -0,0 +1,254 @@
+/**
+ * @file scanrun.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Vectorized skipping of character runs
+ *
+ * Scanner spends most of time in whitespace, line comments and identifiers,
+ * code generator in string literals, so these runs are skipped by SSE2/AVX2
+ * kernels. Best level supported by CPU
+ * is selected at runtime, scalar kernels are used on other architectures
+ */
+
+#include "scanrun.h"
+
+// SSE2 is part of x86-64, AVX2 kernels are compiled for their functions only
+#if defined(__SSE2__)
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Check if character is whitespace (as isspace in C locale)
+ */
+static inline bool IsSpace(unsigned char c) {
+  return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+/**
+ * @brief Check if character can be part of identifier
+ */
+static inline bool IsIdent(unsigned char c) {
+  return (unsigned char)((c | 0x20) - 'a') <= 'z' - 'a' ||
+         (unsigned char)(c - '0') <= 9 || c == '_';
+}
+
+/**
+ * @brief Check if character is written to IFJcode24 literal without escape
+ */
+static inline bool IsLiteral(unsigned char c) {
+  return c > ' ' && c != '#' && c != '\\';
+}
+
+static size_t WhitespaceScalar(const unsigned char *data, size_t length) {
+  size_t i = 0;
+  while (i < length && IsSpace(data[i]))
+    i++;
+  return i;
+}
+
+static size_t LineScalar(const unsigned char *data, size_t length) {
+  size_t i = 0;
+  while (i < length && data[i] != '\n')
+    i++;
+  return i;
+}
+
+static size_t IdentScalar(const unsigned char *data, size_t length) {
+  size_t i = 0;
+  while (i < length && IsIdent(data[i]))
+    i++;
+  return i;
+}
+
+static size_t LiteralScalar(const unsigned char *data, size_t length) {
+  size_t i = 0;
+  while (i < length && IsLiteral(data[i]))
+    i++;
+  return i;
+}
+
+#ifdef SCAN_X86
+// Lanes where lo <= x <= lo + span (unsigned)
+#define SSE2_RANGE(x, lo, span)                                                \
+  _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8(x, _mm_set1_epi8(lo)),              \
+                              _mm_set1_epi8(span)),                            \
+                 _mm_sub_epi8(x, _mm_set1_epi8(lo)))
+
+static inline __m128i SpaceMask16(__m128i x) {
+  return _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')),
+                      SSE2_RANGE(x, '\t', '\r' - '\t'));
+}
+
+static inline __m128i IdentMask16(__m128i x) {
+  __m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+  return _mm_or_si128(
+      _mm_or_si128(SSE2_RANGE(lower, 'a', 'z' - 'a'), SSE2_RANGE(x, '0', 9)),
+      _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+}
+
+// Lanes with char that has to be escaped in IFJcode24 literal
+static inline __m128i EscapeMask16(__m128i x) {
+  return _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(' ')), x),
+                   _mm_cmpeq_epi8(x, _mm_set1_epi8('#'))),
+      _mm_cmpeq_epi8(x, _mm_set1_epi8('\\')));
+}
+
+// Body of SSE2 kernel, MATCH gives lanes which belong to run
+#define SSE2_RUN(MATCH, SCALAR)                                                \
+  size_t i = 0;                                                                \
+  for (; i + 16 <= length; i += 16) {                                          \
+    __m128i x = _mm_loadu_si128((const __m128i *)(data + i));                  \
+    unsigned stop = ~(unsigned)_mm_movemask_epi8(MATCH) & 0xFFFF;              \
+    if (stop != 0)                                                             \
+      return i + __builtin_ctz(stop);                                          \
+  }                                                                            \
+  return i + SCALAR(data + i, length - i)
+
+static size_t WhitespaceSSE2(const unsigned char *data, size_t length) {
+  SSE2_RUN(SpaceMask16(x), WhitespaceScalar);
+}
+
+static size_t LineSSE2(const unsigned char *data, size_t length) {
+  SSE2_RUN(_mm_xor_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('\n')),
+                         _mm_set1_epi8(-1)),
+           LineScalar);
+}
+
+static size_t IdentSSE2(const unsigned char *data, size_t length) {
+  SSE2_RUN(IdentMask16(x), IdentScalar);
+}
+
+static size_t LiteralSSE2(const unsigned char *data, size_t length) {
+  SSE2_RUN(_mm_xor_si128(EscapeMask16(x), _mm_set1_epi8(-1)), LiteralScalar);
+}
+
+#define AVX2_RANGE(x, lo, span)                                                \
+  _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_sub_epi8(x, _mm256_set1_epi8(lo)),  \
+                                    _mm256_set1_epi8(span)),                   \
+                    _mm256_sub_epi8(x, _mm256_set1_epi8(lo)))
+
+__attribute__((target("avx2"))) static inline __m256i SpaceMask32(__m256i x) {
+  return _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')),
+                         AVX2_RANGE(x, '\t', '\r' - '\t'));
+}
+
+__attribute__((target("avx2"))) static inline __m256i IdentMask32(__m256i x) {
+  __m256i lower = _mm256_or_si256(x, _mm256_set1_epi8(0x20));
+  return _mm256_or_si256(_mm256_or_si256(AVX2_RANGE(lower, 'a', 'z' - 'a'),
+                                         AVX2_RANGE(x, '0', 9)),
+                         _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+}
+
+__attribute__((target("avx2"))) static inline __m256i EscapeMask32(__m256i x) {
+  return _mm256_or_si256(
+      _mm256_or_si256(
+          _mm256_cmpeq_epi8(_mm256_min_epu8(x, _mm256_set1_epi8(' ')), x),
+          _mm256_cmpeq_epi8(x, _mm256_set1_epi8('#'))),
+      _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\\')));
+}
+
+// Body of AVX2 kernel, rest shorter than 32 characters is left to SSE2
+#define AVX2_RUN(MATCH, SSE2)                                                  \
+  size_t i = 0;                                                                \
+  for (; i + 32 <= length; i += 32) {                                          \
+    __m256i x = _mm256_loadu_si256((const __m256i *)(data + i));               \
+    unsigned stop = ~(unsigned)_mm256_movemask_epi8(MATCH);                    \
+    if (stop != 0)                                                             \
+      return i + __builtin_ctz(stop);                                          \
+  }                                                                            \
+  return i + SSE2(data + i, length - i)
+
+__attribute__((target("avx2"))) static size_t
+WhitespaceAVX2(const unsigned char *data, size_t length) {
+  AVX2_RUN(SpaceMask32(x), WhitespaceSSE2);
+}
+
+__attribute__((target("avx2"))) static size_t
+LineAVX2(const unsigned char *data, size_t length) {
+  AVX2_RUN(_mm256_xor_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\n')),
+                            _mm256_set1_epi8(-1)),
+           LineSSE2);
+}
+
+__attribute__((target("avx2"))) static size_t
+IdentAVX2(const unsigned char *data, size_t length) {
+  AVX2_RUN(IdentMask32(x), IdentSSE2);
+}
+
+__attribute__((target("avx2"))) static size_t
+LiteralAVX2(const unsigned char *data, size_t length) {
+  AVX2_RUN(_mm256_xor_si256(EscapeMask32(x), _mm256_set1_epi8(-1)),
+           LiteralSSE2);
+}
+#endif
+
+static const ScanRun levels[SCAN_LEVEL_COUNT] = {
+    [SCAN_SCALAR] = {WhitespaceScalar, LineScalar, IdentScalar, LiteralScalar},
+#ifdef SCAN_X86
+    [SCAN_SSE2] = {WhitespaceSSE2, LineSSE2, IdentSSE2, LiteralSSE2},
+    [SCAN_AVX2] = {WhitespaceAVX2, LineAVX2, IdentAVX2, LiteralAVX2},
+#endif
+};
+
+// Kernels used by scanner
+ScanRun scan_run = {WhitespaceScalar, LineScalar, IdentScalar, LiteralScalar};
+
+/**
+ * @brief Check if CPU can run kernels of level
+ */
+static bool ScanLevelSupported(ScanLevel level) {
+  switch (level) {
+  case SCAN_SCALAR:
+    return true;
+#ifdef SCAN_X86
+  case SCAN_SSE2:
+    return __builtin_cpu_supports("sse2");
+  case SCAN_AVX2:
+    return __builtin_cpu_supports("avx2");
+#endif
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Use kernels of level
+ *
+ * @param level Level of kernels
+ * @return False if CPU doesn't support level, kernels are not changed then
+ */
+bool ScanRunSelect(ScanLevel level) {
+  if (level >= SCAN_LEVEL_COUNT || !ScanLevelSupported(level))
+    return false;
+  scan_run = levels[level];
+  return true;
+}
+
+/**
+ * @brief Select the best kernels supported by CPU
+ *
+ * @return Selected level
+ */
+ScanLevel ScanRunInit() {
+#ifdef SCAN_X86
+  __builtin_cpu_init();
+#endif
+  ScanLevel level = SCAN_LEVEL_COUNT;
+  while (level-- > SCAN_SCALAR) {
+    if (ScanRunSelect(level))
+      break;
+  }
+  return level;
+}
+
+/**
+ * @brief Get name of level
+ */
+const char *ScanLevelName(ScanLevel level) {
+  static const char *names[SCAN_LEVEL_COUNT] = {"scalar", "sse2", "avx2"};
+  return level < SCAN_LEVEL_COUNT ? names[level] : "unknown";
+}
@@ -0,0 +1,41 @@
+/**
+ * @file scanrun.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dias Tursynbayev xtursyd00
+ *
+ * @brief Vectorized skipping of character runs header file
+ */
+
+#ifndef SCANRUN_H
+#define SCANRUN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum ScanLevel {
+  SCAN_SCALAR = 0, // One character at a time
+  SCAN_SSE2,       // 16 characters at a time
+  SCAN_AVX2,       // 32 characters at a time
+  SCAN_LEVEL_COUNT
+} ScanLevel;
+
+/**
+ * @brief Kernels of selected level, every kernel returns length of run
+ * at the start of data
+ */
+typedef struct ScanRun {
+  size_t (*whitespace)(const unsigned char *data, size_t length); // isspace
+  size_t (*line)(const unsigned char *data, size_t length);       // until \n
+  size_t (*ident)(const unsigned char *data, size_t length); // [A-Za-z0-9_]
+  // Chars written to IFJcode24 string literal as they are (not \ddd)
+  size_t (*literal)(const unsigned char *data, size_t length);
+} ScanRun;
+
+extern ScanRun scan_run;
+
+ScanLevel ScanRunInit();
+bool ScanRunSelect(ScanLevel level);
+const char *ScanLevelName(ScanLevel level);
+
+#endif // SCANRUN_H
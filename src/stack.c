@@ -5,10 +5,15 @@
  * @author Dmitrii Ivanushkin xivanu00
  *
  * @brief Stack implementation
+ * Stack items are recycled through pool, because they are pushed and popped
+ * for every operand and operator of expressions
  */
 
 #include "stack.h"
 
+// Pool of all stack items
+Pool stack_pool = POOL_INIT("stackItem", stackItem);
+
 /**
  * Initialize stack by setting pointer to the top to NULL
  *
@@ -27,7 +32,7 @@ void InitStack(stack *s) { s->top = NULL; }
  * @return
  */
 int PushStack(stack *s, void *d) {
-  stackItem *new_element_ptr = InvokeAlloc(sizeof(stackItem));
+  stackItem *new_element_ptr = PoolAlloc(&stack_pool);
 
   new_element_ptr->data = d;
   new_element_ptr->next = s->top;
@@ -49,7 +54,7 @@ void PopStack(stack *s) {
   if (s->top != NULL) {
     element_ptr = s->top;
     s->top = s->top->next;
-    InvokeFree(element_ptr);
+    PoolFree(&stack_pool, element_ptr);
   }
 }
 
@@ -77,7 +82,8 @@ void *TopStack(stack *s) {
 bool IsEmptyStack(stack *s) { return (s->top == NULL); }
 
 /**
- * Frees stack with every item
+ * Frees every item of stack
+ * Stack structure itself belongs to its owner
  *
  * @param s - pointer to stack
  *
@@ -88,5 +94,4 @@ void FreeStack(stack *s) {
   while (!IsEmptyStack(s)) {
     PopStack(s);
   }
-  InvokeFree(s);
 }
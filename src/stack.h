@@ -11,6 +11,7 @@
 #define STACK_H
 
 #include "memory.h"
+#include "pool.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +25,8 @@ typedef struct {
   stackItem *top;
 } stack;
 
+extern Pool stack_pool;
+
 void InitStack(stack *s);
 int PushStack(stack *s, void *d);
 void PopStack(stack *s);
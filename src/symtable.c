@@ -5,113 +5,429 @@
  * @author Dmitrii Ivanushkin xivanu00
  *
  * @brief symbolic table functions implementation,
- * variant of hashtable with open addressing
+ * variant of hashtable with open addressing (Swiss table)
+ *
+ * Functions are in function table, which is filled by first pass of parser
+ * and only read afterwards. Parameters and variables of function which is
+ * parsed are in its own local table, dropped at the end of the function
  */
 
 #include "symtable.h"
 
-// This symtable will be accessed from outside
+// SSE2 is part of x86-64, other targets compare control bytes one by one
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Control bytes of free slots have high bit set, used slots hold hash tag
+#define CTRL_EMPTY ((signed char)0x80)
+#define CTRL_DELETED ((signed char)0xFE)
+
+// These tables will be accessed from outside
 // only via functions defined in this file
-static symtable *global_table = NULL;
+static symtable *function_table = NULL;
+static symtable *local_table = NULL;
+
+// Function table is read only after SymtableSealFunctions
+static bool functions_sealed = false;
+
+// Functions by their id
+static symtable_item_data **functions = NULL;
+static size_t functions_size = 0;
+static size_t functions_capacity = 0;
+
+// Function id of every atom interned before sealing, calls are resolved
+// by index instead of hashing
+static unsigned int *function_ids = NULL;
+static size_t function_ids_size = 0;
+
+// Symtable arena before local table, data of locals are freed up to it
+static ArenaMark local_mark;
+
+// Capacity policy of tables created by SymtableInit
+static SymtableCapacity table_capacity = SYMTABLE_POW2;
+static double table_max_load = SYMTABLE_MAX_LOAD;
 
 /**
- * Linear probing function to resolve collisions
+ * Set capacity policy of the next SymtableInit
  *
- * @param index - current hashed index
- * @param step - current step in the probe sequence
+ * @param capacity - power of two (index by mask) or prime (index by modulo)
+ *                   count of groups
+ * @param max_load - table grows when count of items and tombstones would
+ *                   exceed this part of capacity, has to be in (0, 1)
  *
- * @return unsigned int new hash index
+ * @return
  */
-unsigned int LinearProbe(int index, int step) {
-  return (index + C * step) % MAX_SIZE;
+void SymtableConfigure(SymtableCapacity capacity, double max_load) {
+  table_capacity = capacity;
+  table_max_load = max_load > 0 && max_load < 1 ? max_load : SYMTABLE_MAX_LOAD;
 }
 
 /**
- * Initialize the symtable
+ * Smallest valid count of groups of the table that is at least min
+ *
+ * @param min - minimal count of groups
+ *
+ * @return size_t power of two or prime number
+ */
+static size_t SymtableGroupsAtLeast(size_t min) {
+  size_t groups = SYMTABLE_INIT / SYMTABLE_GROUP;
+  if (table_capacity == SYMTABLE_POW2) {
+    while (groups < min)
+      groups *= 2;
+    return groups;
+  }
+  groups = min > groups ? min : groups;
+  groups |= 1;
+  while (true) {
+    bool prime = true;
+    for (size_t d = 3; d * d <= groups && prime; d += 2)
+      prime = groups % d != 0;
+    if (prime)
+      return groups;
+    groups += 2;
+  }
+}
+
+/**
+ * Bit mask of slots in group whose control byte is equal to tag
+ *
+ * @param ctrl - control bytes of group
+ * @param tag - hash tag or CTRL_EMPTY
+ *
+ * @return unsigned bit i is set if slot i matches
+ */
+static inline unsigned GroupMatch(const signed char *ctrl, signed char tag) {
+#if defined(__SSE2__)
+  __m128i group = _mm_load_si128((const __m128i *)ctrl);
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag)));
+#else
+  unsigned mask = 0;
+  for (int i = 0; i < SYMTABLE_GROUP; i++)
+    mask |= (unsigned)(ctrl[i] == tag) << i;
+  return mask;
+#endif
+}
+
+/**
+ * Bit mask of empty or deleted slots in group
+ *
+ * @param ctrl - control bytes of group
+ *
+ * @return unsigned bit i is set if slot i is free
+ */
+static inline unsigned GroupFree(const signed char *ctrl) {
+#if defined(__SSE2__)
+  return _mm_movemask_epi8(_mm_load_si128((const __m128i *)ctrl));
+#else
+  unsigned mask = 0;
+  for (int i = 0; i < SYMTABLE_GROUP; i++)
+    mask |= (unsigned)(ctrl[i] < 0) << i;
+  return mask;
+#endif
+}
+
+/**
+ * Hash tag stored in control byte, top 7 bits that are not used by group index
+ *
+ * @param key - atom of identifier
+ *
+ * @return signed char tag in range 0..127
+ */
+static inline signed char SymtableTag(Atom *key) { return key->hash >> 57; }
+
+/**
+ * Get group in table from hash of atom, which was computed once when it was
+ * lexed, so no key is ever hashed again
+ *
+ * @param table - function or local table
+ * @param key - atom to hash
+ *
+ * @return size_t home group of atom
+ */
+static inline size_t SymtableHash(symtable *table, Atom *key) {
+  if (table_capacity == SYMTABLE_POW2)
+    return key->hash & (table->groups - 1);
+  return key->hash % table->groups;
+}
+
+/**
+ * Next group of probe sequence, triangular for power of two count of groups
+ * (visits every group), linear for prime count
+ *
+ * @param table - function or local table
+ * @param group - current group
+ * @param step - count of groups visited so far
+ *
+ * @return size_t next group
+ */
+static inline size_t NextGroup(symtable *table, size_t group, size_t step) {
+  if (table_capacity == SYMTABLE_POW2)
+    return (group + step) & (table->groups - 1);
+  group++;
+  return group < table->groups ? group : 0;
+}
+
+/**
+ * Allocate empty slots of the table, all slot arrays are one allocation
+ * with control bytes at the end, aligned to 16 bytes for SSE2 loads
+ *
+ * @param table - function or local table
+ * @param groups - count of groups
+ *
+ * @return
+ */
+static void SymtableAllocSlots(symtable *table, size_t groups) {
+  size_t capacity = groups * SYMTABLE_GROUP;
+  char *slots = InvokeAlloc((sizeof(Atom *) + sizeof(symtable_item_data *) +
+                             sizeof(signed char)) *
+                            capacity);
+  table->keys = (Atom **)slots;
+  table->data = (symtable_item_data **)(slots + sizeof(Atom *) * capacity);
+  table->ctrl =
+      (signed char *)(slots + (sizeof(Atom *) + sizeof(symtable_item_data *)) *
+                                  capacity);
+  memset(table->ctrl, CTRL_EMPTY, capacity);
+  table->capacity = capacity;
+  table->groups = groups;
+  table->tombstones = 0;
+}
+
+/**
+ * Create empty table
+ *
+ * @return symtable* new table in symtable arena
+ */
+static symtable *SymtableCreate() {
+  symtable *table = ArenaAlloc(ARENA_SYMTABLE, sizeof(symtable));
+  memset(table, 0, sizeof(symtable));
+  SymtableAllocSlots(table, SymtableGroupsAtLeast(SYMTABLE_INIT / SYMTABLE_GROUP));
+  return table;
+}
+
+/**
+ * Free slots and stacks of table, table itself is in symtable arena
+ *
+ * @param table - function or local table
+ *
+ * @return
+ */
+static void SymtableDestroy(symtable *table) {
+  InvokeFree(table->keys);
+  InvokeFree(table->symbols);
+  InvokeFree(table->scopes);
+}
+
+/**
+ * Initialize the symtable with empty function table
  *
  * @return
  */
 void SymtableInit() {
-  global_table = InvokeAlloc(sizeof(symtable));
-  for (int i = 0; i < MAX_SIZE; i++) {
-    (*global_table)[i] = NULL;
+  function_table = SymtableCreate();
+  local_table = NULL;
+  functions_sealed = false;
+  functions_size = 0;
+}
+
+/**
+ * Create local table of function whose body is parsed
+ *
+ * @return
+ */
+void SymtableEnterFunction() {
+  SymtableLeaveFunction();
+  local_mark = ArenaGetMark(ARENA_SYMTABLE);
+  local_table = SymtableCreate();
+}
+
+/**
+ * Drop local table of function with data of its variables
+ *
+ * @return
+ */
+void SymtableLeaveFunction() {
+  if (local_table == NULL)
+    return;
+  SymtableDestroy(local_table);
+  ArenaRewind(ARENA_SYMTABLE, local_mark);
+  local_table = NULL;
+}
+
+/**
+ * First free slot of probe sequence of key
+ *
+ * @param table - function or local table
+ * @param key - atom of identifier
+ *
+ * @return size_t index of empty or deleted slot
+ */
+static size_t SymtableFreeSlot(symtable *table, Atom *key) {
+  size_t group = SymtableHash(table, key);
+  for (size_t step = 1;; step++) {
+    phase_counters[COUNTER_SYMTABLE_PROBES]++;
+    unsigned free = GroupFree(table->ctrl + group * SYMTABLE_GROUP);
+    if (free != 0)
+      return group * SYMTABLE_GROUP + __builtin_ctz(free);
+    group = NextGroup(table, group, step);
   }
 }
 
 /**
- * Create a pointer to the item which will be filled later
+ * Slot of key in the table
  *
- * @param key - key string
- * @param type - type of item that will be added
+ * @param table - function or local table
+ * @param key - atom of identifier
  *
- * @return symtable_item_data* pointer to the item data that will be added
+ * @return size_t index of slot or capacity if key is not in table
  */
-symtable_item_data *SymtableAdd(char *key, SymbolType type) {
-  // Generate hash from key
-  unsigned int index = SymtableHash(key);
+static size_t SymtableSlot(symtable *table, Atom *key) {
+  signed char tag = SymtableTag(key);
+  size_t group = SymtableHash(table, key);
+  size_t slot = table->capacity;
+  size_t step = 1;
+  unsigned match = 0;
+  while (true) {
+    phase_counters[COUNTER_SYMTABLE_PROBES]++;
+    const signed char *ctrl = table->ctrl + group * SYMTABLE_GROUP;
+    for (match = GroupMatch(ctrl, tag); match != 0; match &= match - 1) {
+      slot = group * SYMTABLE_GROUP + __builtin_ctz(match);
+      if (table->keys[slot] == key)
+        break;
+    }
+    // Key would be in first empty slot of its sequence, so it's not further
+    if (match != 0 || GroupMatch(ctrl, CTRL_EMPTY) != 0 ||
+        step == table->groups)
+      break;
+    group = NextGroup(table, group, step++);
+  }
+  probe_lengths[step < PROBE_BUCKETS ? step - 1 : PROBE_BUCKETS - 1]++;
+  return match != 0 ? slot : table->capacity;
+}
 
-  // Linear probing to handle collisions if current index is already busy
-  int i = 1;
-  while ((*global_table)[index] != NULL && (*global_table)[index]->busy) {
-    index = LinearProbe(index, i);
-    i++;
+/**
+ * Move all items to new slots without tombstones, table doubles only if
+ * items alone fill over half of max_load, otherwise tombstones are dropped.
+ * Data of items are not moved, so pointers returned by SymtableAdd
+ * and SymtableFind stay valid
+ *
+ * @param table - function or local table
+ *
+ * @return
+ */
+static void SymtableRehash(symtable *table) {
+  char *old_slots = (char *)table->keys;
+  Atom **old_keys = table->keys;
+  symtable_item_data **old_data = table->data;
+  signed char *old_ctrl = table->ctrl;
+  size_t old_capacity = table->capacity;
+
+  size_t groups = table->groups;
+  if (table->count * 2 >= old_capacity * table_max_load)
+    groups = SymtableGroupsAtLeast(groups * 2);
+  SymtableAllocSlots(table, groups);
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_ctrl[i] < 0)
+      continue;
+    size_t slot = SymtableFreeSlot(table, old_keys[i]);
+    table->ctrl[slot] = old_ctrl[i];
+    table->keys[slot] = old_keys[i];
+    table->data[slot] = old_data[i];
   }
+  InvokeFree(old_slots);
+}
 
-  // Allocate memory for new item
-  if ((*global_table)[index] == NULL) {
-    (*global_table)[index] = InvokeAlloc(sizeof(symtable_item));
-    (*global_table)[index]->data = InvokeAlloc(sizeof(symtable_item_data));
+/**
+ * Create a pointer to the item which will be filled later
+ * Functions go to function table, variables to local table
+ *
+ * @param key - atom of identifier
+ * @param type - type of item that will be added
+ *
+ * @return symtable_item_data* pointer to the item data that will be added
+ */
+symtable_item_data *SymtableAdd(Atom *key, SymbolType type) {
+  symtable *table = type == ST_FUNC ? function_table : local_table;
+  if (table == NULL || (type == ST_FUNC && functions_sealed))
+    InvokeExit(INTERNAL_ERROR);
+
+  if (table->count + table->tombstones + 1 > table->capacity * table_max_load)
+    SymtableRehash(table);
+
+  // First empty or deleted slot of probe sequence
+  size_t slot = SymtableFreeSlot(table, key);
+  if (table->ctrl[slot] == CTRL_DELETED)
+    table->tombstones--;
+
+  // Data are allocated separately, so they don't move when table grows
+  symtable_item_data *data =
+      ArenaAlloc(ARENA_SYMTABLE, sizeof(symtable_item_data));
+  table->ctrl[slot] = SymtableTag(key);
+  table->keys[slot] = key; // Atoms live until the end of compilation
+  table->data[slot] = data;
+  table->count++;
+
+  // Variable belongs to the current scope
+  if (type != ST_FUNC) {
+    if (table->symbols_size == table->symbols_capacity) {
+      table->symbols_capacity = table->symbols_capacity * 2 + SCOPES_INIT;
+      table->symbols = InvokeRealloc(
+          table->symbols, sizeof(symtable_item) * table->symbols_capacity);
+    }
+    table->symbols[table->symbols_size++] = (symtable_item){key, data};
   }
 
-  (*global_table)[index]->key = InvokeStrdup(key); // Copy key
-  (*global_table)[index]->busy = true;             // Set busy
   // Fill data
-  symtable_item_data *data = (*global_table)[index]->data;
   data->symType = type; // Define the type of item to be added right away
   // Based on the type fill data with initial values
   if (type == ST_FUNC) {
-    InvokeInitVarsArray(&data->details.func.params);
-    InvokeInitVarsArray(&data->details.func.variables);
+    if (functions_size == functions_capacity) {
+      functions_capacity = functions_capacity * 2 + SYMTABLE_INIT;
+      functions = InvokeRealloc(functions, sizeof(symtable_item_data *) *
+                                               functions_capacity);
+    }
+    data->details.func.id = functions_size;
+    functions[functions_size++] = data;
+    VarSetInit(&data->details.func.params);
+    VarSetInit(&data->details.func.variables);
     data->details.func.returnMade = false;
   } else if (type == ST_VAR_VAR || type == ST_VAR_CONST) {
-    data->details.var.scope = 0;
     data->details.var.type = ST_NOT_DEFINED;
     data->details.var.isUsed = false;
     data->details.var.isModificationUsed = type == ST_VAR_CONST ? true : false;
     data->details.var.isKnown = false;
   }
 
-  return (*global_table)[index]->data;
+  return data;
 }
 
 /**
- * Remove an item based on a key from the symtable
+ * Remove a variable based on a key from the local table
+ * Slot becomes tombstone, so probe sequences going through it stay intact,
+ * only slot of group that still has empty slot can become empty again
  *
  * @param key - key that defines which item will be removed
  *
  * @return
  */
-void SymtableRemove(char *key) {
-  // Generate hash from key
-  unsigned int index = SymtableHash(key);
-
-  // Free item
-  int i = 0;
-  while ((*global_table)[index] != NULL) {
-    if ((*global_table)[index]->busy &&
-        strcmp((*global_table)[index]->key, key) == 0) {
-      InvokeFree((*global_table)[index]->key);
-      InvokeFree((*global_table)[index]->data);
-      InvokeFree((*global_table)[index]);
-      (*global_table)[index] = NULL;
-      return;
-    }
-
-    // Linear probing to handle collisions if current index is already busy
-    // and keys are not same
-    index = LinearProbe(index, i);
-    i++;
+void SymtableRemove(Atom *key) {
+  if (local_table == NULL)
+    return;
+  size_t slot = SymtableSlot(local_table, key);
+  if (slot == local_table->capacity)
+    return;
+
+  // Lookups stop at group with empty slot, so they never went past this one
+  const signed char *group =
+      local_table->ctrl + slot / SYMTABLE_GROUP * SYMTABLE_GROUP;
+  if (GroupMatch(group, CTRL_EMPTY) != 0) {
+    local_table->ctrl[slot] = CTRL_EMPTY;
+  } else {
+    local_table->ctrl[slot] = CTRL_DELETED;
+    local_table->tombstones++;
   }
+  // Memory stays in symtable arena until the end of function
+  local_table->count--;
 }
 
 /**
@@ -121,117 +437,145 @@ void SymtableRemove(char *key) {
  */
 void SymtableClear() {
   // Free whole table with every item
-  if (global_table != NULL) {
-    for (int i = 0; i < MAX_SIZE; i++) {
-      if ((*global_table)[i] != NULL && (*global_table)[i]->busy) {
-        InvokeFree((*global_table)[i]->key);
-        InvokeFree((*global_table)[i]->data);
-        InvokeFree((*global_table)[i]);
-        (*global_table)[i] = NULL;
-      }
-    }
-
-    InvokeFree(global_table);
-    global_table = NULL;
+  if (function_table != NULL) {
+    if (local_table != NULL)
+      SymtableDestroy(local_table);
+    SymtableDestroy(function_table);
+    InvokeFree(functions);
+    InvokeFree(function_ids);
+    functions = NULL;
+    functions_capacity = 0;
+    function_ids = NULL;
+    function_ids_size = 0;
+    ArenaRelease(ARENA_SYMTABLE);
+    function_table = NULL;
+    local_table = NULL;
   }
 }
 
 /**
- * Find a token by key in the symtable.
+ * Find item by key in one table
  *
- * @param key pointer to a key which will be searched for
+ * @param table - function or local table, can be NULL
+ * @param key - atom of identifier
  *
  * @return symtable_item_data* pointer to the found item OR NULL!
  */
-symtable_item_data *SymtableFind(char *key) {
-  // Generate hash from key
-  unsigned int index = SymtableHash(key);
-
-  int i = 1;
-  while ((*global_table)[index] != NULL) {
-    if ((*global_table)[index]->busy &&
-        strcmp((*global_table)[index]->key, key) == 0) {
-      return (*global_table)[index]->data;
-    } else {
-      // Linear probing to handle collisions if current index is already busy
-      // and keys are not same
-      index = LinearProbe(index, i);
-    }
-    i++;
-  }
-
-  return NULL;
+static symtable_item_data *SymtableFindIn(symtable *table, Atom *key) {
+  if (table == NULL)
+    return NULL;
+  size_t slot = SymtableSlot(table, key);
+  return slot < table->capacity ? table->data[slot] : NULL;
 }
 
 /**
- * DJB hash function for generating a hash value from a string
+ * Find a token by key in the symtable, variables of the current function
+ * are searched first, then functions
  *
- * @param key key string to hash
+ * @param key pointer to a key which will be searched for
  *
- * @return unsigned int hash value
+ * @return symtable_item_data* pointer to the found item OR NULL!
  */
-unsigned int SymtableHash(char *key) {
-  unsigned int hash = 5381;
-  int c;
+symtable_item_data *SymtableFind(Atom *key) {
+  symtable_item_data *data = SymtableFindIn(local_table, key);
+  return data != NULL ? data : SymtableFindIn(function_table, key);
+}
 
-  while ((c = *key++)) {
-    hash = ((hash << 5) + hash) + c;
+/**
+ * Make function table read only, it's called after first pass of parser,
+ * when all functions are declared
+ *
+ * @return
+ */
+void SymtableSealFunctions() {
+  function_ids_size = AtomCount();
+  function_ids = InvokeAlloc(sizeof(unsigned int) * (function_ids_size + 1));
+  for (size_t i = 0; i < function_ids_size; i++)
+    function_ids[i] = SYMTABLE_NO_FUNCTION;
+  for (size_t slot = 0; slot < function_table->capacity; slot++) {
+    if (function_table->ctrl[slot] >= 0)
+      function_ids[function_table->keys[slot]->id] =
+          function_table->data[slot]->details.func.id;
   }
+  functions_sealed = true;
+}
 
-  return hash % MAX_SIZE;
+/**
+ * Get id of function, after sealing it's found by id of atom without hashing
+ *
+ * @param key - atom of identifier
+ *
+ * @return unsigned int id of function or SYMTABLE_NO_FUNCTION
+ */
+unsigned int SymtableFunctionId(Atom *key) {
+  if (functions_sealed) {
+    // Atoms interned after sealing are not functions
+    return key->id < function_ids_size ? function_ids[key->id]
+                                       : SYMTABLE_NO_FUNCTION;
+  }
+  symtable_item_data *data = SymtableFindIn(function_table, key);
+  return data != NULL ? data->details.func.id : SYMTABLE_NO_FUNCTION;
 }
 
 /**
- * Enter a new scope in symtable
+ * Get function by its id
+ *
+ * @param id - id of function from SymtableFunctionId
+ *
+ * @return symtable_item_data* function data
+ */
+symtable_item_data *SymtableFunction(unsigned int id) { return functions[id]; }
+
+/**
+ * Count of functions, ids are from 0 to count - 1
+ *
+ * @return size_t count of functions
+ */
+size_t SymtableFunctionCount() { return functions_size; }
+
+/**
+ * Enter a new scope in local table
+ * Scope is start of its variables on the stack of variables
  *
  * @return
  */
 void SymtableEnterScope() {
-  // For every existing item (vars and consts)
-  for (int i = 0; i < MAX_SIZE; i++) {
-    if ((*global_table)[i] != NULL && (*global_table)[i]->busy) {
-      symtable_item_data *data = (*global_table)[i]->data;
-
-      if (data->symType == ST_VAR_VAR || data->symType == ST_VAR_CONST) {
-        // Increase scope counter
-        data->details.var.scope++;
-      }
-    }
+  if (local_table == NULL)
+    InvokeExit(INTERNAL_ERROR);
+  if (local_table->depth == local_table->scopes_capacity) {
+    local_table->scopes_capacity = local_table->scopes_capacity * 2 + SCOPES_INIT;
+    local_table->scopes = InvokeRealloc(
+        local_table->scopes, sizeof(size_t) * local_table->scopes_capacity);
   }
+  local_table->scopes[local_table->depth++] = local_table->symbols_size;
 }
 
 /**
- * Leave the current scope, removing variables or decreasing scope counter
+ * Leave the current scope, removing variables declared in it
+ * Only variables of this scope are checked, rest of table is not touched
  *
  * @return
  */
 void SymtableLeaveScope() {
-  // For every existing item (vars and consts)
-  for (int i = 0; i < MAX_SIZE; i++) {
-    if ((*global_table)[i] != NULL && (*global_table)[i]->busy) {
-      symtable_item_data *data = (*global_table)[i]->data;
-
-      if (data->symType == ST_VAR_VAR || data->symType == ST_VAR_CONST) {
-        if (data->details.var.scope == 0) {
-          if (!data->details.var.isUsed) {
-            InvokeExit(UNUSED_VAR_ERROR);
-          }
-
-          if (data->symType == ST_VAR_VAR &&
-              !data->details.var.isModificationUsed) {
-            InvokeExit(UNUSED_VAR_ERROR);
-          }
-
-          // Remove variable token from symtable if there is no error
-          char *key_to_remove = (*global_table)[i]->key;
-          SymtableRemove(key_to_remove);
-        } else {
-          // Derease scope counter if is not 0 yet
-          data->details.var.scope--;
-        }
-      }
+  if (local_table == NULL || local_table->depth == 0)
+    return;
+  size_t start = local_table->scopes[--local_table->depth];
+
+  for (size_t i = start; i < local_table->symbols_size; i++) {
+    symtable_item_data *data = local_table->symbols[i].data;
+    if (!data->details.var.isUsed) {
+      InvokeExit(UNUSED_VAR_ERROR);
     }
+
+    if (data->symType == ST_VAR_VAR &&
+        !data->details.var.isModificationUsed) {
+      InvokeExit(UNUSED_VAR_ERROR);
+    }
+
+    // Remove variable token from symtable if there is no error
+    SymtableRemove(local_table->symbols[i].key);
   }
+  local_table->symbols_size = start;
 }
 
 /**
@@ -239,18 +583,15 @@ void SymtableLeaveScope() {
  *
  * @return symtable_item_data function data
  */
-symtable_item_data *SymtableAssertFunction(char *key) {
-  symtable_item_data *data = SymtableFind(key);
+symtable_item_data *SymtableAssertFunction(Atom *key) {
+  // Variable never has name of function, so only functions are searched
+  unsigned int id = SymtableFunctionId(key);
 
-  if (data == NULL) {
+  if (id == SYMTABLE_NO_FUNCTION) {
     InvokeExit(DEFINITION_ERROR);
   }
 
-  if (data->symType != ST_FUNC) {
-    InvokeExit(DEFINITION_ERROR);
-  }
-
-  return data;
+  return functions[id];
 }
 
 /**
@@ -258,8 +599,9 @@ symtable_item_data *SymtableAssertFunction(char *key) {
  *
  * @return symtable_item_data function data
  */
-symtable_item_data *SymtableAssertVariable(char *key) {
-  symtable_item_data *data = SymtableFind(key);
+symtable_item_data *SymtableAssertVariable(Atom *key) {
+  // Function would fail this check too, so only variables are searched
+  symtable_item_data *data = SymtableFindIn(local_table, key);
 
   if (data == NULL) {
     InvokeExit(DEFINITION_ERROR);
@@ -277,8 +619,9 @@ symtable_item_data *SymtableAssertVariable(char *key) {
  *
  * @return symtable_item_data function data
  */
-symtable_item_data *SymtableUpdate_isUsed(char *key) {
-  symtable_item_data *data = SymtableFind(key);
+symtable_item_data *SymtableUpdate_isUsed(Atom *key) {
+  // Function would fail this check too, so only variables are searched
+  symtable_item_data *data = SymtableFindIn(local_table, key);
 
   if (data == NULL) {
     InvokeExit(DEFINITION_ERROR);
@@ -297,8 +640,9 @@ symtable_item_data *SymtableUpdate_isUsed(char *key) {
  *
  * @return symtable_item_data function data
  */
-symtable_item_data *SymtableUpdate_isModified(char *key) {
-  symtable_item_data *data = SymtableFind(key);
+symtable_item_data *SymtableUpdate_isModified(Atom *key) {
+  // Function would fail this check too, so only variables are searched
+  symtable_item_data *data = SymtableFindIn(local_table, key);
 
   if (data == NULL) {
     InvokeExit(DEFINITION_ERROR);
@@ -322,16 +666,10 @@ symtable_item_data *SymtableUpdate_isModified(char *key) {
  * @return
  */
 void SymtableAssertReturns() {
-  // For every existing item (funcs)
-  for (int i = 0; i < MAX_SIZE; i++) {
-    if ((*global_table)[i] != NULL && (*global_table)[i]->busy) {
-      symtable_item_data *data = (*global_table)[i]->data;
-
-      if (data->symType == ST_FUNC) {
-        // Check if return is made
-        if (!data->details.func.returnMade)
-          InvokeExit(RETURN_ERROR);
-      }
-    }
+  // For every function
+  for (size_t i = 0; i < functions_size; i++) {
+    // Check if return is made
+    if (!functions[i]->details.func.returnMade)
+      InvokeExit(RETURN_ERROR);
   }
 }
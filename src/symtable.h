@@ -5,23 +5,36 @@
  * @author Dmitrii Ivanushkin xivanu00
  *
  * @brief symbolic table functions header,
- * variant of hashtable with open addressing
+ * variant of hashtable with open addressing (Swiss table)
  */
 
 #ifndef SYMTABLE_H
 #define SYMTABLE_H
 
+#include "arena.h"
 #include "array.h"
+#include "atom.h"
 #include "error.h"
 #include "memory.h"
+#include "phase.h"
 #include "stack.h"
+#include "varset.h"
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_SIZE 3001 // Prime number (around 2000 IDs + minimum 25%)
-#define C 1           // Linear probing step size
+#define SYMTABLE_INIT 64              // Initial capacity
+#define SYMTABLE_MAX_LOAD 0.875       // Default part of capacity that can be used
+#define SYMTABLE_GROUP 16             // Slots whose tags are compared at once
+#define SCOPES_INIT 16                // Initial capacity of scope stack
+#define SYMTABLE_NO_FUNCTION UINT_MAX // Id of builtin or unknown function
+
+typedef enum {
+  SYMTABLE_POW2,  // Count of groups is power of two, index is masked hash
+  SYMTABLE_PRIME, // Count of groups is prime, index is hash modulo groups
+} SymtableCapacity;
 
 typedef enum {
   ST_FUNC,
@@ -45,21 +58,21 @@ typedef enum {
 
 typedef struct var_data {
   DataType type;
-  int scope;
   bool isUsed;
   bool isModificationUsed;
   bool isKnown;
 } var_data;
 
 typedef struct Param {
-  char *name;
+  Atom *name;
   DataType type;
 } Param;
 
 typedef struct func_data {
+  unsigned int id; // Dense index of function in order of declaration
   DataType returnType;
-  List *params;
-  List *variables;
+  VarSet *params;    // Param items in declaration order
+  VarSet *variables; // Atoms of all variables in function
   bool returnMade;
 } func_data;
 
@@ -72,26 +85,54 @@ typedef struct {
 } symtable_item_data;
 
 typedef struct {
-  char *key;
+  Atom *key;
   symtable_item_data *data;
-  bool busy;
 } symtable_item;
 
-typedef symtable_item *symtable[MAX_SIZE];
+/**
+ * Open addressing table split to groups of SYMTABLE_GROUP slots
+ * Every slot has control byte: 7 bits of hash of its key, empty or deleted,
+ * whole group of control bytes is compared with one SSE2 instruction.
+ * Keys and data pointers are inline in slot arrays, data itself never moves,
+ * so pointers returned by SymtableAdd and SymtableFind stay valid.
+ * Table grows when items with tombstones exceed max_load of capacity.
+ * Functions and variables of one function are in separate tables,
+ * variables are also on stack of scopes, so leaving scope touches only them
+ */
+typedef struct {
+  signed char *ctrl;         // Control byte of every slot
+  Atom **keys;               // Key of every slot
+  symtable_item_data **data; // Data of every slot
+  size_t capacity;           // Count of slots
+  size_t groups;             // Count of groups, capacity / SYMTABLE_GROUP
+  size_t count;              // Count of items
+  size_t tombstones;         // Count of deleted slots
+  symtable_item *symbols;    // Variables of open scopes in order of declaration
+  size_t symbols_size;
+  size_t symbols_capacity;
+  size_t *scopes;            // Start of every open scope in symbols
+  size_t depth;              // Count of open scopes
+  size_t scopes_capacity;
+} symtable;
 
-unsigned int LinearProbe(int index, int step);
+void SymtableConfigure(SymtableCapacity capacity, double max_load);
 void SymtableInit();
-symtable_item_data *SymtableAdd(char *key, SymbolType type);
-void SymtableRemove(char *key);
+void SymtableSealFunctions();
+unsigned int SymtableFunctionId(Atom *key);
+symtable_item_data *SymtableFunction(unsigned int id);
+size_t SymtableFunctionCount();
+void SymtableEnterFunction();
+void SymtableLeaveFunction();
+symtable_item_data *SymtableAdd(Atom *key, SymbolType type);
+void SymtableRemove(Atom *key);
 void SymtableClear();
-symtable_item_data *SymtableFind(char *key);
-unsigned int SymtableHash(char *key);
+symtable_item_data *SymtableFind(Atom *key);
 void SymtableEnterScope();
 void SymtableLeaveScope();
-symtable_item_data *SymtableAssertFunction(char *key);
-symtable_item_data *SymtableAssertVariable(char *key);
-symtable_item_data *SymtableUpdate_isUsed(char *key);
-symtable_item_data *SymtableUpdate_isModified(char *key);
+symtable_item_data *SymtableAssertFunction(Atom *key);
+symtable_item_data *SymtableAssertVariable(Atom *key);
+symtable_item_data *SymtableUpdate_isUsed(Atom *key);
+symtable_item_data *SymtableUpdate_isModified(Atom *key);
 void SymtableAssertReturns();
 
 #endif // SYMTABLE_H
@@ -0,0 +1,138 @@
+/**
+ * @file trace.c
+ * Project - IFJ Project 2024
+ *
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Chrome trace events of compilation
+ *
+ * Spans are written as complete events ("ph": "X") in JSON array format,
+ * which chrome://tracing and Perfetto load even without closing bracket,
+ * so trace of compilation that ended by error is still readable
+ */
+
+#include "trace.h"
+
+static FILE *trace_file = NULL;
+
+// Time of TraceOpen, events start from zero
+static double trace_origin;
+
+// Function that is parsed or generated, added to arguments of spans
+static const char *trace_function = NULL;
+
+// If no event was written yet
+static bool trace_first = true;
+
+/**
+ * @brief Write string as JSON string literal, quote, backslash
+ * and control characters are escaped
+ *
+ * @param out Output file
+ * @param str Null terminated string
+ */
+void TraceJsonString(FILE *out, const char *str) {
+  fputc('"', out);
+  for (const unsigned char *c = (const unsigned char *)str; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\')
+      fprintf(out, "\\%c", *c);
+    else if (*c < 0x20)
+      fprintf(out, "\\u%04x", *c);
+    else
+      fputc(*c, out);
+  }
+  fputc('"', out);
+}
+
+/**
+ * @brief Start writing trace events to file
+ *
+ * @param path Path of trace file
+ * @return false if file can't be opened
+ */
+bool TraceOpen(const char *path) {
+  trace_file = fopen(path, "w");
+  if (trace_file == NULL)
+    return false;
+  trace_origin = PhaseNow();
+  fprintf(trace_file, "[\n");
+  return true;
+}
+
+/**
+ * @brief If trace events are written
+ */
+bool TraceEnabled() { return trace_file != NULL; }
+
+/**
+ * @brief Start time of span
+ *
+ * @return Current time or 0 if tracing is off, then clock is not read
+ */
+double TraceStart() { return trace_file != NULL ? PhaseNow() : 0; }
+
+/**
+ * @brief Set function of the following spans
+ *
+ * @param name Name of function or NULL outside of functions
+ */
+void TraceSetFunction(const char *name) { trace_function = name; }
+
+/**
+ * @brief Write span that ends now, on main thread
+ *
+ * @param name Name of span (string literal)
+ * @param start Time from TraceStart
+ * @param first_token Index of first token or TRACE_NO_TOKENS
+ * @param last_token Index of last token
+ */
+void TraceSpan(const char *name, double start, size_t first_token,
+               size_t last_token) {
+  if (trace_file != NULL)
+    TraceEvent(name, 0, start, PhaseNow(), first_token, last_token);
+}
+
+/**
+ * @brief Write span with given start and end
+ *
+ * @param name Name of span (string literal)
+ * @param thread Thread of span, 0 is main thread
+ * @param start Start time from TraceStart or PhaseNow
+ * @param end End time
+ * @param first_token Index of first token or TRACE_NO_TOKENS
+ * @param last_token Index of last token
+ */
+void TraceEvent(const char *name, int thread, double start, double end,
+                size_t first_token, size_t last_token) {
+  if (trace_file == NULL)
+    return;
+  fprintf(trace_file, "%s{\"name\": ", trace_first ? "" : ",\n");
+  TraceJsonString(trace_file, name);
+  fprintf(trace_file,
+          ", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, "
+          "\"ts\": %.3f, \"dur\": %.3f, \"args\": {",
+          thread, (start - trace_origin) * 1e6, (end - start) * 1e6);
+  trace_first = false;
+
+  bool comma = false;
+  if (trace_function != NULL) {
+    fprintf(trace_file, "\"function\": ");
+    TraceJsonString(trace_file, trace_function);
+    comma = true;
+  }
+  if (first_token != TRACE_NO_TOKENS)
+    fprintf(trace_file, "%s\"first_token\": %zu, \"last_token\": %zu",
+            comma ? ", " : "", first_token, last_token);
+  fprintf(trace_file, "}}");
+}
+
+/**
+ * @brief Finish trace file
+ */
+void TraceClose() {
+  if (trace_file == NULL)
+    return;
+  fprintf(trace_file, "\n]\n");
+  fclose(trace_file);
+  trace_file = NULL;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file trace.h
+ * Project - IFJ Project 2024
+ *
+ * @author Dmitrii Ivanushkin xivanu00
+ *
+ * @brief Chrome trace events of compilation header file
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "phase.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_NO_TOKENS SIZE_MAX // Span without token range
+#define TRACE_EXPR_MIN 64        // Shorter expressions (in tokens) are not traced
+
+void TraceJsonString(FILE *out, const char *str);
+bool TraceOpen(const char *path);
+bool TraceEnabled();
+double TraceStart();
+void TraceSetFunction(const char *name);
+void TraceSpan(const char *name, double start, size_t first_token,
+               size_t last_token);
+void TraceEvent(const char *name, int thread, double start, double end,
+                size_t first_token, size_t last_token);
+void TraceClose();
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * @file varset.c
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Insertion ordered set of variables source file
+ * Used for parameters and variables of function
+ */
+
+#include "varset.h"
+
+#define VARSET_INIT_CAPACITY 8
+#define VARSET_INIT_INDEX 16
+
+/**
+ * @brief Initialize and allocate new set
+ *
+ * @param set set that has to be initialized
+ */
+void VarSetInit(VarSet **set) {
+  (*set) = InvokeAlloc(sizeof(VarSet));
+  (*set)->array = InvokeAlloc(sizeof(void *) * VARSET_INIT_CAPACITY);
+  (*set)->keys = InvokeAlloc(sizeof(Atom *) * VARSET_INIT_CAPACITY);
+  (*set)->index = InvokeAlloc(sizeof(size_t) * VARSET_INIT_INDEX);
+  memset((*set)->index, 0, sizeof(size_t) * VARSET_INIT_INDEX);
+  (*set)->size = 0;
+  (*set)->capacity = VARSET_INIT_CAPACITY;
+  (*set)->index_capacity = VARSET_INIT_INDEX;
+}
+
+/**
+ * @brief Find slot of name in hash index
+ *
+ * @param set set
+ * @param key name of element
+ *
+ * @return slot with this name or empty slot where it has to be
+ */
+static size_t VarSetSlot(VarSet *set, Atom *key) {
+  size_t mask = set->index_capacity - 1;
+  size_t slot = key->hash & mask;
+  while (set->index[slot] != 0 && set->keys[set->index[slot] - 1] != key)
+    slot = (slot + 1) & mask;
+  return slot;
+}
+
+/**
+ * @brief Double hash index and put all elements there again
+ *
+ * @param set set
+ */
+static void VarSetRehash(VarSet *set) {
+  InvokeFree(set->index);
+  set->index_capacity *= 2;
+  set->index = InvokeAlloc(sizeof(size_t) * set->index_capacity);
+  memset(set->index, 0, sizeof(size_t) * set->index_capacity);
+  for (size_t i = 0; i < set->size; i++)
+    set->index[VarSetSlot(set, set->keys[i])] = i + 1;
+}
+
+/**
+ * @brief Add element to the end of set, if there is no element with same name
+ *
+ * @param set set
+ * @param key name of element
+ * @param element element that has to be added
+ *
+ * @return true if element was added, false if name was already in set
+ */
+bool VarSetAdd(VarSet *set, Atom *key, void *element) {
+  size_t slot = VarSetSlot(set, key);
+  if (set->index[slot] != 0)
+    return false;
+
+  if (set->size == set->capacity) {
+    set->capacity *= 2;
+    set->array = InvokeRealloc(set->array, sizeof(void *) * set->capacity);
+    set->keys = InvokeRealloc(set->keys, sizeof(Atom *) * set->capacity);
+  }
+  set->array[set->size] = element;
+  set->keys[set->size] = key;
+  set->size++;
+  set->index[slot] = set->size;
+
+  // Keep index at most half full
+  if (set->size * 2 > set->index_capacity)
+    VarSetRehash(set);
+  return true;
+}
+
+/**
+ * @brief Find element by its name
+ *
+ * @param set set
+ * @param key name of element
+ *
+ * @return found element or NULL
+ */
+void *VarSetFind(VarSet *set, Atom *key) {
+  size_t slot = VarSetSlot(set, key);
+  return set->index[slot] != 0 ? set->array[set->index[slot] - 1] : NULL;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file varset.h
+ * Project - IFJ Project 2024
+ *
+ * @author Albert Tikaiev xtikaia00
+ *
+ * @brief Insertion ordered set of variables header file
+ */
+
+#ifndef VARSET_H
+#define VARSET_H
+
+#include "atom.h"
+#include "error.h"
+#include "memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Dynamic array of elements with unique names
+ * Elements stay in order of insertion (order of DEFVAR in code generator),
+ * hash index on names gives O(1) membership check
+ */
+typedef struct VarSet {
+  void **array;          /**< Elements in order of insertion*/
+  Atom **keys;           /**< Name of every element*/
+  size_t size;           /**< Count of elements*/
+  size_t capacity;       /**< Capacity of array and keys*/
+  size_t *index;         /**< Position + 1 of element in array, 0 if empty*/
+  size_t index_capacity; /**< Capacity of index, power of 2*/
+} VarSet;
+
+void VarSetInit(VarSet **set);
+bool VarSetAdd(VarSet *set, Atom *key, void *element);
+void *VarSetFind(VarSet *set, Atom *key);
+
+#endif
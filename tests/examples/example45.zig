@@ -0,0 +1,11 @@
+// Characters that have to be escaped in IFJcode24 string literal
+const ifj = @import("ifj24.zig");
+pub fn main() void {
+  ifj.write("#hash# and\ttab\\\x23\n");
+  const s: []u8 = ifj.string(
+    \\multi # line	with tab
+    \\  #
+  );
+  ifj.write(s);
+  ifj.write("\n");
+}
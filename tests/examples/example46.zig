@@ -0,0 +1,3106 @@
+// More functions than slots of former fixed symtable (3001)
+const ifj = @import("ifj24.zig");
+pub fn a0() void {}
+pub fn a1() void {}
+pub fn a2() void {}
+pub fn a3() void {}
+pub fn a4() void {}
+pub fn a5() void {}
+pub fn a6() void {}
+pub fn a7() void {}
+pub fn a8() void {}
+pub fn a9() void {}
+pub fn a10() void {}
+pub fn a11() void {}
+pub fn a12() void {}
+pub fn a13() void {}
+pub fn a14() void {}
+pub fn a15() void {}
+pub fn a16() void {}
+pub fn a17() void {}
+pub fn a18() void {}
+pub fn a19() void {}
+pub fn a20() void {}
+pub fn a21() void {}
+pub fn a22() void {}
+pub fn a23() void {}
+pub fn a24() void {}
+pub fn a25() void {}
+pub fn a26() void {}
+pub fn a27() void {}
+pub fn a28() void {}
+pub fn a29() void {}
+pub fn a30() void {}
+pub fn a31() void {}
+pub fn a32() void {}
+pub fn a33() void {}
+pub fn a34() void {}
+pub fn a35() void {}
+pub fn a36() void {}
+pub fn a37() void {}
+pub fn a38() void {}
+pub fn a39() void {}
+pub fn a40() void {}
+pub fn a41() void {}
+pub fn a42() void {}
+pub fn a43() void {}
+pub fn a44() void {}
+pub fn a45() void {}
+pub fn a46() void {}
+pub fn a47() void {}
+pub fn a48() void {}
+pub fn a49() void {}
+pub fn a50() void {}
+pub fn a51() void {}
+pub fn a52() void {}
+pub fn a53() void {}
+pub fn a54() void {}
+pub fn a55() void {}
+pub fn a56() void {}
+pub fn a57() void {}
+pub fn a58() void {}
+pub fn a59() void {}
+pub fn a60() void {}
+pub fn a61() void {}
+pub fn a62() void {}
+pub fn a63() void {}
+pub fn a64() void {}
+pub fn a65() void {}
+pub fn a66() void {}
+pub fn a67() void {}
+pub fn a68() void {}
+pub fn a69() void {}
+pub fn a70() void {}
+pub fn a71() void {}
+pub fn a72() void {}
+pub fn a73() void {}
+pub fn a74() void {}
+pub fn a75() void {}
+pub fn a76() void {}
+pub fn a77() void {}
+pub fn a78() void {}
+pub fn a79() void {}
+pub fn a80() void {}
+pub fn a81() void {}
+pub fn a82() void {}
+pub fn a83() void {}
+pub fn a84() void {}
+pub fn a85() void {}
+pub fn a86() void {}
+pub fn a87() void {}
+pub fn a88() void {}
+pub fn a89() void {}
+pub fn a90() void {}
+pub fn a91() void {}
+pub fn a92() void {}
+pub fn a93() void {}
+pub fn a94() void {}
+pub fn a95() void {}
+pub fn a96() void {}
+pub fn a97() void {}
+pub fn a98() void {}
+pub fn a99() void {}
+pub fn a100() void {}
+pub fn a101() void {}
+pub fn a102() void {}
+pub fn a103() void {}
+pub fn a104() void {}
+pub fn a105() void {}
+pub fn a106() void {}
+pub fn a107() void {}
+pub fn a108() void {}
+pub fn a109() void {}
+pub fn a110() void {}
+pub fn a111() void {}
+pub fn a112() void {}
+pub fn a113() void {}
+pub fn a114() void {}
+pub fn a115() void {}
+pub fn a116() void {}
+pub fn a117() void {}
+pub fn a118() void {}
+pub fn a119() void {}
+pub fn a120() void {}
+pub fn a121() void {}
+pub fn a122() void {}
+pub fn a123() void {}
+pub fn a124() void {}
+pub fn a125() void {}
+pub fn a126() void {}
+pub fn a127() void {}
+pub fn a128() void {}
+pub fn a129() void {}
+pub fn a130() void {}
+pub fn a131() void {}
+pub fn a132() void {}
+pub fn a133() void {}
+pub fn a134() void {}
+pub fn a135() void {}
+pub fn a136() void {}
+pub fn a137() void {}
+pub fn a138() void {}
+pub fn a139() void {}
+pub fn a140() void {}
+pub fn a141() void {}
+pub fn a142() void {}
+pub fn a143() void {}
+pub fn a144() void {}
+pub fn a145() void {}
+pub fn a146() void {}
+pub fn a147() void {}
+pub fn a148() void {}
+pub fn a149() void {}
+pub fn a150() void {}
+pub fn a151() void {}
+pub fn a152() void {}
+pub fn a153() void {}
+pub fn a154() void {}
+pub fn a155() void {}
+pub fn a156() void {}
+pub fn a157() void {}
+pub fn a158() void {}
+pub fn a159() void {}
+pub fn a160() void {}
+pub fn a161() void {}
+pub fn a162() void {}
+pub fn a163() void {}
+pub fn a164() void {}
+pub fn a165() void {}
+pub fn a166() void {}
+pub fn a167() void {}
+pub fn a168() void {}
+pub fn a169() void {}
+pub fn a170() void {}
+pub fn a171() void {}
+pub fn a172() void {}
+pub fn a173() void {}
+pub fn a174() void {}
+pub fn a175() void {}
+pub fn a176() void {}
+pub fn a177() void {}
+pub fn a178() void {}
+pub fn a179() void {}
+pub fn a180() void {}
+pub fn a181() void {}
+pub fn a182() void {}
+pub fn a183() void {}
+pub fn a184() void {}
+pub fn a185() void {}
+pub fn a186() void {}
+pub fn a187() void {}
+pub fn a188() void {}
+pub fn a189() void {}
+pub fn a190() void {}
+pub fn a191() void {}
+pub fn a192() void {}
+pub fn a193() void {}
+pub fn a194() void {}
+pub fn a195() void {}
+pub fn a196() void {}
+pub fn a197() void {}
+pub fn a198() void {}
+pub fn a199() void {}
+pub fn a200() void {}
+pub fn a201() void {}
+pub fn a202() void {}
+pub fn a203() void {}
+pub fn a204() void {}
+pub fn a205() void {}
+pub fn a206() void {}
+pub fn a207() void {}
+pub fn a208() void {}
+pub fn a209() void {}
+pub fn a210() void {}
+pub fn a211() void {}
+pub fn a212() void {}
+pub fn a213() void {}
+pub fn a214() void {}
+pub fn a215() void {}
+pub fn a216() void {}
+pub fn a217() void {}
+pub fn a218() void {}
+pub fn a219() void {}
+pub fn a220() void {}
+pub fn a221() void {}
+pub fn a222() void {}
+pub fn a223() void {}
+pub fn a224() void {}
+pub fn a225() void {}
+pub fn a226() void {}
+pub fn a227() void {}
+pub fn a228() void {}
+pub fn a229() void {}
+pub fn a230() void {}
+pub fn a231() void {}
+pub fn a232() void {}
+pub fn a233() void {}
+pub fn a234() void {}
+pub fn a235() void {}
+pub fn a236() void {}
+pub fn a237() void {}
+pub fn a238() void {}
+pub fn a239() void {}
+pub fn a240() void {}
+pub fn a241() void {}
+pub fn a242() void {}
+pub fn a243() void {}
+pub fn a244() void {}
+pub fn a245() void {}
+pub fn a246() void {}
+pub fn a247() void {}
+pub fn a248() void {}
+pub fn a249() void {}
+pub fn a250() void {}
+pub fn a251() void {}
+pub fn a252() void {}
+pub fn a253() void {}
+pub fn a254() void {}
+pub fn a255() void {}
+pub fn a256() void {}
+pub fn a257() void {}
+pub fn a258() void {}
+pub fn a259() void {}
+pub fn a260() void {}
+pub fn a261() void {}
+pub fn a262() void {}
+pub fn a263() void {}
+pub fn a264() void {}
+pub fn a265() void {}
+pub fn a266() void {}
+pub fn a267() void {}
+pub fn a268() void {}
+pub fn a269() void {}
+pub fn a270() void {}
+pub fn a271() void {}
+pub fn a272() void {}
+pub fn a273() void {}
+pub fn a274() void {}
+pub fn a275() void {}
+pub fn a276() void {}
+pub fn a277() void {}
+pub fn a278() void {}
+pub fn a279() void {}
+pub fn a280() void {}
+pub fn a281() void {}
+pub fn a282() void {}
+pub fn a283() void {}
+pub fn a284() void {}
+pub fn a285() void {}
+pub fn a286() void {}
+pub fn a287() void {}
+pub fn a288() void {}
+pub fn a289() void {}
+pub fn a290() void {}
+pub fn a291() void {}
+pub fn a292() void {}
+pub fn a293() void {}
+pub fn a294() void {}
+pub fn a295() void {}
+pub fn a296() void {}
+pub fn a297() void {}
+pub fn a298() void {}
+pub fn a299() void {}
+pub fn a300() void {}
+pub fn a301() void {}
+pub fn a302() void {}
+pub fn a303() void {}
+pub fn a304() void {}
+pub fn a305() void {}
+pub fn a306() void {}
+pub fn a307() void {}
+pub fn a308() void {}
+pub fn a309() void {}
+pub fn a310() void {}
+pub fn a311() void {}
+pub fn a312() void {}
+pub fn a313() void {}
+pub fn a314() void {}
+pub fn a315() void {}
+pub fn a316() void {}
+pub fn a317() void {}
+pub fn a318() void {}
+pub fn a319() void {}
+pub fn a320() void {}
+pub fn a321() void {}
+pub fn a322() void {}
+pub fn a323() void {}
+pub fn a324() void {}
+pub fn a325() void {}
+pub fn a326() void {}
+pub fn a327() void {}
+pub fn a328() void {}
+pub fn a329() void {}
+pub fn a330() void {}
+pub fn a331() void {}
+pub fn a332() void {}
+pub fn a333() void {}
+pub fn a334() void {}
+pub fn a335() void {}
+pub fn a336() void {}
+pub fn a337() void {}
+pub fn a338() void {}
+pub fn a339() void {}
+pub fn a340() void {}
+pub fn a341() void {}
+pub fn a342() void {}
+pub fn a343() void {}
+pub fn a344() void {}
+pub fn a345() void {}
+pub fn a346() void {}
+pub fn a347() void {}
+pub fn a348() void {}
+pub fn a349() void {}
+pub fn a350() void {}
+pub fn a351() void {}
+pub fn a352() void {}
+pub fn a353() void {}
+pub fn a354() void {}
+pub fn a355() void {}
+pub fn a356() void {}
+pub fn a357() void {}
+pub fn a358() void {}
+pub fn a359() void {}
+pub fn a360() void {}
+pub fn a361() void {}
+pub fn a362() void {}
+pub fn a363() void {}
+pub fn a364() void {}
+pub fn a365() void {}
+pub fn a366() void {}
+pub fn a367() void {}
+pub fn a368() void {}
+pub fn a369() void {}
+pub fn a370() void {}
+pub fn a371() void {}
+pub fn a372() void {}
+pub fn a373() void {}
+pub fn a374() void {}
+pub fn a375() void {}
+pub fn a376() void {}
+pub fn a377() void {}
+pub fn a378() void {}
+pub fn a379() void {}
+pub fn a380() void {}
+pub fn a381() void {}
+pub fn a382() void {}
+pub fn a383() void {}
+pub fn a384() void {}
+pub fn a385() void {}
+pub fn a386() void {}
+pub fn a387() void {}
+pub fn a388() void {}
+pub fn a389() void {}
+pub fn a390() void {}
+pub fn a391() void {}
+pub fn a392() void {}
+pub fn a393() void {}
+pub fn a394() void {}
+pub fn a395() void {}
+pub fn a396() void {}
+pub fn a397() void {}
+pub fn a398() void {}
+pub fn a399() void {}
+pub fn a400() void {}
+pub fn a401() void {}
+pub fn a402() void {}
+pub fn a403() void {}
+pub fn a404() void {}
+pub fn a405() void {}
+pub fn a406() void {}
+pub fn a407() void {}
+pub fn a408() void {}
+pub fn a409() void {}
+pub fn a410() void {}
+pub fn a411() void {}
+pub fn a412() void {}
+pub fn a413() void {}
+pub fn a414() void {}
+pub fn a415() void {}
+pub fn a416() void {}
+pub fn a417() void {}
+pub fn a418() void {}
+pub fn a419() void {}
+pub fn a420() void {}
+pub fn a421() void {}
+pub fn a422() void {}
+pub fn a423() void {}
+pub fn a424() void {}
+pub fn a425() void {}
+pub fn a426() void {}
+pub fn a427() void {}
+pub fn a428() void {}
+pub fn a429() void {}
+pub fn a430() void {}
+pub fn a431() void {}
+pub fn a432() void {}
+pub fn a433() void {}
+pub fn a434() void {}
+pub fn a435() void {}
+pub fn a436() void {}
+pub fn a437() void {}
+pub fn a438() void {}
+pub fn a439() void {}
+pub fn a440() void {}
+pub fn a441() void {}
+pub fn a442() void {}
+pub fn a443() void {}
+pub fn a444() void {}
+pub fn a445() void {}
+pub fn a446() void {}
+pub fn a447() void {}
+pub fn a448() void {}
+pub fn a449() void {}
+pub fn a450() void {}
+pub fn a451() void {}
+pub fn a452() void {}
+pub fn a453() void {}
+pub fn a454() void {}
+pub fn a455() void {}
+pub fn a456() void {}
+pub fn a457() void {}
+pub fn a458() void {}
+pub fn a459() void {}
+pub fn a460() void {}
+pub fn a461() void {}
+pub fn a462() void {}
+pub fn a463() void {}
+pub fn a464() void {}
+pub fn a465() void {}
+pub fn a466() void {}
+pub fn a467() void {}
+pub fn a468() void {}
+pub fn a469() void {}
+pub fn a470() void {}
+pub fn a471() void {}
+pub fn a472() void {}
+pub fn a473() void {}
+pub fn a474() void {}
+pub fn a475() void {}
+pub fn a476() void {}
+pub fn a477() void {}
+pub fn a478() void {}
+pub fn a479() void {}
+pub fn a480() void {}
+pub fn a481() void {}
+pub fn a482() void {}
+pub fn a483() void {}
+pub fn a484() void {}
+pub fn a485() void {}
+pub fn a486() void {}
+pub fn a487() void {}
+pub fn a488() void {}
+pub fn a489() void {}
+pub fn a490() void {}
+pub fn a491() void {}
+pub fn a492() void {}
+pub fn a493() void {}
+pub fn a494() void {}
+pub fn a495() void {}
+pub fn a496() void {}
+pub fn a497() void {}
+pub fn a498() void {}
+pub fn a499() void {}
+pub fn a500() void {}
+pub fn a501() void {}
+pub fn a502() void {}
+pub fn a503() void {}
+pub fn a504() void {}
+pub fn a505() void {}
+pub fn a506() void {}
+pub fn a507() void {}
+pub fn a508() void {}
+pub fn a509() void {}
+pub fn a510() void {}
+pub fn a511() void {}
+pub fn a512() void {}
+pub fn a513() void {}
+pub fn a514() void {}
+pub fn a515() void {}
+pub fn a516() void {}
+pub fn a517() void {}
+pub fn a518() void {}
+pub fn a519() void {}
+pub fn a520() void {}
+pub fn a521() void {}
+pub fn a522() void {}
+pub fn a523() void {}
+pub fn a524() void {}
+pub fn a525() void {}
+pub fn a526() void {}
+pub fn a527() void {}
+pub fn a528() void {}
+pub fn a529() void {}
+pub fn a530() void {}
+pub fn a531() void {}
+pub fn a532() void {}
+pub fn a533() void {}
+pub fn a534() void {}
+pub fn a535() void {}
+pub fn a536() void {}
+pub fn a537() void {}
+pub fn a538() void {}
+pub fn a539() void {}
+pub fn a540() void {}
+pub fn a541() void {}
+pub fn a542() void {}
+pub fn a543() void {}
+pub fn a544() void {}
+pub fn a545() void {}
+pub fn a546() void {}
+pub fn a547() void {}
+pub fn a548() void {}
+pub fn a549() void {}
+pub fn a550() void {}
+pub fn a551() void {}
+pub fn a552() void {}
+pub fn a553() void {}
+pub fn a554() void {}
+pub fn a555() void {}
+pub fn a556() void {}
+pub fn a557() void {}
+pub fn a558() void {}
+pub fn a559() void {}
+pub fn a560() void {}
+pub fn a561() void {}
+pub fn a562() void {}
+pub fn a563() void {}
+pub fn a564() void {}
+pub fn a565() void {}
+pub fn a566() void {}
+pub fn a567() void {}
+pub fn a568() void {}
+pub fn a569() void {}
+pub fn a570() void {}
+pub fn a571() void {}
+pub fn a572() void {}
+pub fn a573() void {}
+pub fn a574() void {}
+pub fn a575() void {}
+pub fn a576() void {}
+pub fn a577() void {}
+pub fn a578() void {}
+pub fn a579() void {}
+pub fn a580() void {}
+pub fn a581() void {}
+pub fn a582() void {}
+pub fn a583() void {}
+pub fn a584() void {}
+pub fn a585() void {}
+pub fn a586() void {}
+pub fn a587() void {}
+pub fn a588() void {}
+pub fn a589() void {}
+pub fn a590() void {}
+pub fn a591() void {}
+pub fn a592() void {}
+pub fn a593() void {}
+pub fn a594() void {}
+pub fn a595() void {}
+pub fn a596() void {}
+pub fn a597() void {}
+pub fn a598() void {}
+pub fn a599() void {}
+pub fn a600() void {}
+pub fn a601() void {}
+pub fn a602() void {}
+pub fn a603() void {}
+pub fn a604() void {}
+pub fn a605() void {}
+pub fn a606() void {}
+pub fn a607() void {}
+pub fn a608() void {}
+pub fn a609() void {}
+pub fn a610() void {}
+pub fn a611() void {}
+pub fn a612() void {}
+pub fn a613() void {}
+pub fn a614() void {}
+pub fn a615() void {}
+pub fn a616() void {}
+pub fn a617() void {}
+pub fn a618() void {}
+pub fn a619() void {}
+pub fn a620() void {}
+pub fn a621() void {}
+pub fn a622() void {}
+pub fn a623() void {}
+pub fn a624() void {}
+pub fn a625() void {}
+pub fn a626() void {}
+pub fn a627() void {}
+pub fn a628() void {}
+pub fn a629() void {}
+pub fn a630() void {}
+pub fn a631() void {}
+pub fn a632() void {}
+pub fn a633() void {}
+pub fn a634() void {}
+pub fn a635() void {}
+pub fn a636() void {}
+pub fn a637() void {}
+pub fn a638() void {}
+pub fn a639() void {}
+pub fn a640() void {}
+pub fn a641() void {}
+pub fn a642() void {}
+pub fn a643() void {}
+pub fn a644() void {}
+pub fn a645() void {}
+pub fn a646() void {}
+pub fn a647() void {}
+pub fn a648() void {}
+pub fn a649() void {}
+pub fn a650() void {}
+pub fn a651() void {}
+pub fn a652() void {}
+pub fn a653() void {}
+pub fn a654() void {}
+pub fn a655() void {}
+pub fn a656() void {}
+pub fn a657() void {}
+pub fn a658() void {}
+pub fn a659() void {}
+pub fn a660() void {}
+pub fn a661() void {}
+pub fn a662() void {}
+pub fn a663() void {}
+pub fn a664() void {}
+pub fn a665() void {}
+pub fn a666() void {}
+pub fn a667() void {}
+pub fn a668() void {}
+pub fn a669() void {}
+pub fn a670() void {}
+pub fn a671() void {}
+pub fn a672() void {}
+pub fn a673() void {}
+pub fn a674() void {}
+pub fn a675() void {}
+pub fn a676() void {}
+pub fn a677() void {}
+pub fn a678() void {}
+pub fn a679() void {}
+pub fn a680() void {}
+pub fn a681() void {}
+pub fn a682() void {}
+pub fn a683() void {}
+pub fn a684() void {}
+pub fn a685() void {}
+pub fn a686() void {}
+pub fn a687() void {}
+pub fn a688() void {}
+pub fn a689() void {}
+pub fn a690() void {}
+pub fn a691() void {}
+pub fn a692() void {}
+pub fn a693() void {}
+pub fn a694() void {}
+pub fn a695() void {}
+pub fn a696() void {}
+pub fn a697() void {}
+pub fn a698() void {}
+pub fn a699() void {}
+pub fn a700() void {}
+pub fn a701() void {}
+pub fn a702() void {}
+pub fn a703() void {}
+pub fn a704() void {}
+pub fn a705() void {}
+pub fn a706() void {}
+pub fn a707() void {}
+pub fn a708() void {}
+pub fn a709() void {}
+pub fn a710() void {}
+pub fn a711() void {}
+pub fn a712() void {}
+pub fn a713() void {}
+pub fn a714() void {}
+pub fn a715() void {}
+pub fn a716() void {}
+pub fn a717() void {}
+pub fn a718() void {}
+pub fn a719() void {}
+pub fn a720() void {}
+pub fn a721() void {}
+pub fn a722() void {}
+pub fn a723() void {}
+pub fn a724() void {}
+pub fn a725() void {}
+pub fn a726() void {}
+pub fn a727() void {}
+pub fn a728() void {}
+pub fn a729() void {}
+pub fn a730() void {}
+pub fn a731() void {}
+pub fn a732() void {}
+pub fn a733() void {}
+pub fn a734() void {}
+pub fn a735() void {}
+pub fn a736() void {}
+pub fn a737() void {}
+pub fn a738() void {}
+pub fn a739() void {}
+pub fn a740() void {}
+pub fn a741() void {}
+pub fn a742() void {}
+pub fn a743() void {}
+pub fn a744() void {}
+pub fn a745() void {}
+pub fn a746() void {}
+pub fn a747() void {}
+pub fn a748() void {}
+pub fn a749() void {}
+pub fn a750() void {}
+pub fn a751() void {}
+pub fn a752() void {}
+pub fn a753() void {}
+pub fn a754() void {}
+pub fn a755() void {}
+pub fn a756() void {}
+pub fn a757() void {}
+pub fn a758() void {}
+pub fn a759() void {}
+pub fn a760() void {}
+pub fn a761() void {}
+pub fn a762() void {}
+pub fn a763() void {}
+pub fn a764() void {}
+pub fn a765() void {}
+pub fn a766() void {}
+pub fn a767() void {}
+pub fn a768() void {}
+pub fn a769() void {}
+pub fn a770() void {}
+pub fn a771() void {}
+pub fn a772() void {}
+pub fn a773() void {}
+pub fn a774() void {}
+pub fn a775() void {}
+pub fn a776() void {}
+pub fn a777() void {}
+pub fn a778() void {}
+pub fn a779() void {}
+pub fn a780() void {}
+pub fn a781() void {}
+pub fn a782() void {}
+pub fn a783() void {}
+pub fn a784() void {}
+pub fn a785() void {}
+pub fn a786() void {}
+pub fn a787() void {}
+pub fn a788() void {}
+pub fn a789() void {}
+pub fn a790() void {}
+pub fn a791() void {}
+pub fn a792() void {}
+pub fn a793() void {}
+pub fn a794() void {}
+pub fn a795() void {}
+pub fn a796() void {}
+pub fn a797() void {}
+pub fn a798() void {}
+pub fn a799() void {}
+pub fn a800() void {}
+pub fn a801() void {}
+pub fn a802() void {}
+pub fn a803() void {}
+pub fn a804() void {}
+pub fn a805() void {}
+pub fn a806() void {}
+pub fn a807() void {}
+pub fn a808() void {}
+pub fn a809() void {}
+pub fn a810() void {}
+pub fn a811() void {}
+pub fn a812() void {}
+pub fn a813() void {}
+pub fn a814() void {}
+pub fn a815() void {}
+pub fn a816() void {}
+pub fn a817() void {}
+pub fn a818() void {}
+pub fn a819() void {}
+pub fn a820() void {}
+pub fn a821() void {}
+pub fn a822() void {}
+pub fn a823() void {}
+pub fn a824() void {}
+pub fn a825() void {}
+pub fn a826() void {}
+pub fn a827() void {}
+pub fn a828() void {}
+pub fn a829() void {}
+pub fn a830() void {}
+pub fn a831() void {}
+pub fn a832() void {}
+pub fn a833() void {}
+pub fn a834() void {}
+pub fn a835() void {}
+pub fn a836() void {}
+pub fn a837() void {}
+pub fn a838() void {}
+pub fn a839() void {}
+pub fn a840() void {}
+pub fn a841() void {}
+pub fn a842() void {}
+pub fn a843() void {}
+pub fn a844() void {}
+pub fn a845() void {}
+pub fn a846() void {}
+pub fn a847() void {}
+pub fn a848() void {}
+pub fn a849() void {}
+pub fn a850() void {}
+pub fn a851() void {}
+pub fn a852() void {}
+pub fn a853() void {}
+pub fn a854() void {}
+pub fn a855() void {}
+pub fn a856() void {}
+pub fn a857() void {}
+pub fn a858() void {}
+pub fn a859() void {}
+pub fn a860() void {}
+pub fn a861() void {}
+pub fn a862() void {}
+pub fn a863() void {}
+pub fn a864() void {}
+pub fn a865() void {}
+pub fn a866() void {}
+pub fn a867() void {}
+pub fn a868() void {}
+pub fn a869() void {}
+pub fn a870() void {}
+pub fn a871() void {}
+pub fn a872() void {}
+pub fn a873() void {}
+pub fn a874() void {}
+pub fn a875() void {}
+pub fn a876() void {}
+pub fn a877() void {}
+pub fn a878() void {}
+pub fn a879() void {}
+pub fn a880() void {}
+pub fn a881() void {}
+pub fn a882() void {}
+pub fn a883() void {}
+pub fn a884() void {}
+pub fn a885() void {}
+pub fn a886() void {}
+pub fn a887() void {}
+pub fn a888() void {}
+pub fn a889() void {}
+pub fn a890() void {}
+pub fn a891() void {}
+pub fn a892() void {}
+pub fn a893() void {}
+pub fn a894() void {}
+pub fn a895() void {}
+pub fn a896() void {}
+pub fn a897() void {}
+pub fn a898() void {}
+pub fn a899() void {}
+pub fn a900() void {}
+pub fn a901() void {}
+pub fn a902() void {}
+pub fn a903() void {}
+pub fn a904() void {}
+pub fn a905() void {}
+pub fn a906() void {}
+pub fn a907() void {}
+pub fn a908() void {}
+pub fn a909() void {}
+pub fn a910() void {}
+pub fn a911() void {}
+pub fn a912() void {}
+pub fn a913() void {}
+pub fn a914() void {}
+pub fn a915() void {}
+pub fn a916() void {}
+pub fn a917() void {}
+pub fn a918() void {}
+pub fn a919() void {}
+pub fn a920() void {}
+pub fn a921() void {}
+pub fn a922() void {}
+pub fn a923() void {}
+pub fn a924() void {}
+pub fn a925() void {}
+pub fn a926() void {}
+pub fn a927() void {}
+pub fn a928() void {}
+pub fn a929() void {}
+pub fn a930() void {}
+pub fn a931() void {}
+pub fn a932() void {}
+pub fn a933() void {}
+pub fn a934() void {}
+pub fn a935() void {}
+pub fn a936() void {}
+pub fn a937() void {}
+pub fn a938() void {}
+pub fn a939() void {}
+pub fn a940() void {}
+pub fn a941() void {}
+pub fn a942() void {}
+pub fn a943() void {}
+pub fn a944() void {}
+pub fn a945() void {}
+pub fn a946() void {}
+pub fn a947() void {}
+pub fn a948() void {}
+pub fn a949() void {}
+pub fn a950() void {}
+pub fn a951() void {}
+pub fn a952() void {}
+pub fn a953() void {}
+pub fn a954() void {}
+pub fn a955() void {}
+pub fn a956() void {}
+pub fn a957() void {}
+pub fn a958() void {}
+pub fn a959() void {}
+pub fn a960() void {}
+pub fn a961() void {}
+pub fn a962() void {}
+pub fn a963() void {}
+pub fn a964() void {}
+pub fn a965() void {}
+pub fn a966() void {}
+pub fn a967() void {}
+pub fn a968() void {}
+pub fn a969() void {}
+pub fn a970() void {}
+pub fn a971() void {}
+pub fn a972() void {}
+pub fn a973() void {}
+pub fn a974() void {}
+pub fn a975() void {}
+pub fn a976() void {}
+pub fn a977() void {}
+pub fn a978() void {}
+pub fn a979() void {}
+pub fn a980() void {}
+pub fn a981() void {}
+pub fn a982() void {}
+pub fn a983() void {}
+pub fn a984() void {}
+pub fn a985() void {}
+pub fn a986() void {}
+pub fn a987() void {}
+pub fn a988() void {}
+pub fn a989() void {}
+pub fn a990() void {}
+pub fn a991() void {}
+pub fn a992() void {}
+pub fn a993() void {}
+pub fn a994() void {}
+pub fn a995() void {}
+pub fn a996() void {}
+pub fn a997() void {}
+pub fn a998() void {}
+pub fn a999() void {}
+pub fn a1000() void {}
+pub fn a1001() void {}
+pub fn a1002() void {}
+pub fn a1003() void {}
+pub fn a1004() void {}
+pub fn a1005() void {}
+pub fn a1006() void {}
+pub fn a1007() void {}
+pub fn a1008() void {}
+pub fn a1009() void {}
+pub fn a1010() void {}
+pub fn a1011() void {}
+pub fn a1012() void {}
+pub fn a1013() void {}
+pub fn a1014() void {}
+pub fn a1015() void {}
+pub fn a1016() void {}
+pub fn a1017() void {}
+pub fn a1018() void {}
+pub fn a1019() void {}
+pub fn a1020() void {}
+pub fn a1021() void {}
+pub fn a1022() void {}
+pub fn a1023() void {}
+pub fn a1024() void {}
+pub fn a1025() void {}
+pub fn a1026() void {}
+pub fn a1027() void {}
+pub fn a1028() void {}
+pub fn a1029() void {}
+pub fn a1030() void {}
+pub fn a1031() void {}
+pub fn a1032() void {}
+pub fn a1033() void {}
+pub fn a1034() void {}
+pub fn a1035() void {}
+pub fn a1036() void {}
+pub fn a1037() void {}
+pub fn a1038() void {}
+pub fn a1039() void {}
+pub fn a1040() void {}
+pub fn a1041() void {}
+pub fn a1042() void {}
+pub fn a1043() void {}
+pub fn a1044() void {}
+pub fn a1045() void {}
+pub fn a1046() void {}
+pub fn a1047() void {}
+pub fn a1048() void {}
+pub fn a1049() void {}
+pub fn a1050() void {}
+pub fn a1051() void {}
+pub fn a1052() void {}
+pub fn a1053() void {}
+pub fn a1054() void {}
+pub fn a1055() void {}
+pub fn a1056() void {}
+pub fn a1057() void {}
+pub fn a1058() void {}
+pub fn a1059() void {}
+pub fn a1060() void {}
+pub fn a1061() void {}
+pub fn a1062() void {}
+pub fn a1063() void {}
+pub fn a1064() void {}
+pub fn a1065() void {}
+pub fn a1066() void {}
+pub fn a1067() void {}
+pub fn a1068() void {}
+pub fn a1069() void {}
+pub fn a1070() void {}
+pub fn a1071() void {}
+pub fn a1072() void {}
+pub fn a1073() void {}
+pub fn a1074() void {}
+pub fn a1075() void {}
+pub fn a1076() void {}
+pub fn a1077() void {}
+pub fn a1078() void {}
+pub fn a1079() void {}
+pub fn a1080() void {}
+pub fn a1081() void {}
+pub fn a1082() void {}
+pub fn a1083() void {}
+pub fn a1084() void {}
+pub fn a1085() void {}
+pub fn a1086() void {}
+pub fn a1087() void {}
+pub fn a1088() void {}
+pub fn a1089() void {}
+pub fn a1090() void {}
+pub fn a1091() void {}
+pub fn a1092() void {}
+pub fn a1093() void {}
+pub fn a1094() void {}
+pub fn a1095() void {}
+pub fn a1096() void {}
+pub fn a1097() void {}
+pub fn a1098() void {}
+pub fn a1099() void {}
+pub fn a1100() void {}
+pub fn a1101() void {}
+pub fn a1102() void {}
+pub fn a1103() void {}
+pub fn a1104() void {}
+pub fn a1105() void {}
+pub fn a1106() void {}
+pub fn a1107() void {}
+pub fn a1108() void {}
+pub fn a1109() void {}
+pub fn a1110() void {}
+pub fn a1111() void {}
+pub fn a1112() void {}
+pub fn a1113() void {}
+pub fn a1114() void {}
+pub fn a1115() void {}
+pub fn a1116() void {}
+pub fn a1117() void {}
+pub fn a1118() void {}
+pub fn a1119() void {}
+pub fn a1120() void {}
+pub fn a1121() void {}
+pub fn a1122() void {}
+pub fn a1123() void {}
+pub fn a1124() void {}
+pub fn a1125() void {}
+pub fn a1126() void {}
+pub fn a1127() void {}
+pub fn a1128() void {}
+pub fn a1129() void {}
+pub fn a1130() void {}
+pub fn a1131() void {}
+pub fn a1132() void {}
+pub fn a1133() void {}
+pub fn a1134() void {}
+pub fn a1135() void {}
+pub fn a1136() void {}
+pub fn a1137() void {}
+pub fn a1138() void {}
+pub fn a1139() void {}
+pub fn a1140() void {}
+pub fn a1141() void {}
+pub fn a1142() void {}
+pub fn a1143() void {}
+pub fn a1144() void {}
+pub fn a1145() void {}
+pub fn a1146() void {}
+pub fn a1147() void {}
+pub fn a1148() void {}
+pub fn a1149() void {}
+pub fn a1150() void {}
+pub fn a1151() void {}
+pub fn a1152() void {}
+pub fn a1153() void {}
+pub fn a1154() void {}
+pub fn a1155() void {}
+pub fn a1156() void {}
+pub fn a1157() void {}
+pub fn a1158() void {}
+pub fn a1159() void {}
+pub fn a1160() void {}
+pub fn a1161() void {}
+pub fn a1162() void {}
+pub fn a1163() void {}
+pub fn a1164() void {}
+pub fn a1165() void {}
+pub fn a1166() void {}
+pub fn a1167() void {}
+pub fn a1168() void {}
+pub fn a1169() void {}
+pub fn a1170() void {}
+pub fn a1171() void {}
+pub fn a1172() void {}
+pub fn a1173() void {}
+pub fn a1174() void {}
+pub fn a1175() void {}
+pub fn a1176() void {}
+pub fn a1177() void {}
+pub fn a1178() void {}
+pub fn a1179() void {}
+pub fn a1180() void {}
+pub fn a1181() void {}
+pub fn a1182() void {}
+pub fn a1183() void {}
+pub fn a1184() void {}
+pub fn a1185() void {}
+pub fn a1186() void {}
+pub fn a1187() void {}
+pub fn a1188() void {}
+pub fn a1189() void {}
+pub fn a1190() void {}
+pub fn a1191() void {}
+pub fn a1192() void {}
+pub fn a1193() void {}
+pub fn a1194() void {}
+pub fn a1195() void {}
+pub fn a1196() void {}
+pub fn a1197() void {}
+pub fn a1198() void {}
+pub fn a1199() void {}
+pub fn a1200() void {}
+pub fn a1201() void {}
+pub fn a1202() void {}
+pub fn a1203() void {}
+pub fn a1204() void {}
+pub fn a1205() void {}
+pub fn a1206() void {}
+pub fn a1207() void {}
+pub fn a1208() void {}
+pub fn a1209() void {}
+pub fn a1210() void {}
+pub fn a1211() void {}
+pub fn a1212() void {}
+pub fn a1213() void {}
+pub fn a1214() void {}
+pub fn a1215() void {}
+pub fn a1216() void {}
+pub fn a1217() void {}
+pub fn a1218() void {}
+pub fn a1219() void {}
+pub fn a1220() void {}
+pub fn a1221() void {}
+pub fn a1222() void {}
+pub fn a1223() void {}
+pub fn a1224() void {}
+pub fn a1225() void {}
+pub fn a1226() void {}
+pub fn a1227() void {}
+pub fn a1228() void {}
+pub fn a1229() void {}
+pub fn a1230() void {}
+pub fn a1231() void {}
+pub fn a1232() void {}
+pub fn a1233() void {}
+pub fn a1234() void {}
+pub fn a1235() void {}
+pub fn a1236() void {}
+pub fn a1237() void {}
+pub fn a1238() void {}
+pub fn a1239() void {}
+pub fn a1240() void {}
+pub fn a1241() void {}
+pub fn a1242() void {}
+pub fn a1243() void {}
+pub fn a1244() void {}
+pub fn a1245() void {}
+pub fn a1246() void {}
+pub fn a1247() void {}
+pub fn a1248() void {}
+pub fn a1249() void {}
+pub fn a1250() void {}
+pub fn a1251() void {}
+pub fn a1252() void {}
+pub fn a1253() void {}
+pub fn a1254() void {}
+pub fn a1255() void {}
+pub fn a1256() void {}
+pub fn a1257() void {}
+pub fn a1258() void {}
+pub fn a1259() void {}
+pub fn a1260() void {}
+pub fn a1261() void {}
+pub fn a1262() void {}
+pub fn a1263() void {}
+pub fn a1264() void {}
+pub fn a1265() void {}
+pub fn a1266() void {}
+pub fn a1267() void {}
+pub fn a1268() void {}
+pub fn a1269() void {}
+pub fn a1270() void {}
+pub fn a1271() void {}
+pub fn a1272() void {}
+pub fn a1273() void {}
+pub fn a1274() void {}
+pub fn a1275() void {}
+pub fn a1276() void {}
+pub fn a1277() void {}
+pub fn a1278() void {}
+pub fn a1279() void {}
+pub fn a1280() void {}
+pub fn a1281() void {}
+pub fn a1282() void {}
+pub fn a1283() void {}
+pub fn a1284() void {}
+pub fn a1285() void {}
+pub fn a1286() void {}
+pub fn a1287() void {}
+pub fn a1288() void {}
+pub fn a1289() void {}
+pub fn a1290() void {}
+pub fn a1291() void {}
+pub fn a1292() void {}
+pub fn a1293() void {}
+pub fn a1294() void {}
+pub fn a1295() void {}
+pub fn a1296() void {}
+pub fn a1297() void {}
+pub fn a1298() void {}
+pub fn a1299() void {}
+pub fn a1300() void {}
+pub fn a1301() void {}
+pub fn a1302() void {}
+pub fn a1303() void {}
+pub fn a1304() void {}
+pub fn a1305() void {}
+pub fn a1306() void {}
+pub fn a1307() void {}
+pub fn a1308() void {}
+pub fn a1309() void {}
+pub fn a1310() void {}
+pub fn a1311() void {}
+pub fn a1312() void {}
+pub fn a1313() void {}
+pub fn a1314() void {}
+pub fn a1315() void {}
+pub fn a1316() void {}
+pub fn a1317() void {}
+pub fn a1318() void {}
+pub fn a1319() void {}
+pub fn a1320() void {}
+pub fn a1321() void {}
+pub fn a1322() void {}
+pub fn a1323() void {}
+pub fn a1324() void {}
+pub fn a1325() void {}
+pub fn a1326() void {}
+pub fn a1327() void {}
+pub fn a1328() void {}
+pub fn a1329() void {}
+pub fn a1330() void {}
+pub fn a1331() void {}
+pub fn a1332() void {}
+pub fn a1333() void {}
+pub fn a1334() void {}
+pub fn a1335() void {}
+pub fn a1336() void {}
+pub fn a1337() void {}
+pub fn a1338() void {}
+pub fn a1339() void {}
+pub fn a1340() void {}
+pub fn a1341() void {}
+pub fn a1342() void {}
+pub fn a1343() void {}
+pub fn a1344() void {}
+pub fn a1345() void {}
+pub fn a1346() void {}
+pub fn a1347() void {}
+pub fn a1348() void {}
+pub fn a1349() void {}
+pub fn a1350() void {}
+pub fn a1351() void {}
+pub fn a1352() void {}
+pub fn a1353() void {}
+pub fn a1354() void {}
+pub fn a1355() void {}
+pub fn a1356() void {}
+pub fn a1357() void {}
+pub fn a1358() void {}
+pub fn a1359() void {}
+pub fn a1360() void {}
+pub fn a1361() void {}
+pub fn a1362() void {}
+pub fn a1363() void {}
+pub fn a1364() void {}
+pub fn a1365() void {}
+pub fn a1366() void {}
+pub fn a1367() void {}
+pub fn a1368() void {}
+pub fn a1369() void {}
+pub fn a1370() void {}
+pub fn a1371() void {}
+pub fn a1372() void {}
+pub fn a1373() void {}
+pub fn a1374() void {}
+pub fn a1375() void {}
+pub fn a1376() void {}
+pub fn a1377() void {}
+pub fn a1378() void {}
+pub fn a1379() void {}
+pub fn a1380() void {}
+pub fn a1381() void {}
+pub fn a1382() void {}
+pub fn a1383() void {}
+pub fn a1384() void {}
+pub fn a1385() void {}
+pub fn a1386() void {}
+pub fn a1387() void {}
+pub fn a1388() void {}
+pub fn a1389() void {}
+pub fn a1390() void {}
+pub fn a1391() void {}
+pub fn a1392() void {}
+pub fn a1393() void {}
+pub fn a1394() void {}
+pub fn a1395() void {}
+pub fn a1396() void {}
+pub fn a1397() void {}
+pub fn a1398() void {}
+pub fn a1399() void {}
+pub fn a1400() void {}
+pub fn a1401() void {}
+pub fn a1402() void {}
+pub fn a1403() void {}
+pub fn a1404() void {}
+pub fn a1405() void {}
+pub fn a1406() void {}
+pub fn a1407() void {}
+pub fn a1408() void {}
+pub fn a1409() void {}
+pub fn a1410() void {}
+pub fn a1411() void {}
+pub fn a1412() void {}
+pub fn a1413() void {}
+pub fn a1414() void {}
+pub fn a1415() void {}
+pub fn a1416() void {}
+pub fn a1417() void {}
+pub fn a1418() void {}
+pub fn a1419() void {}
+pub fn a1420() void {}
+pub fn a1421() void {}
+pub fn a1422() void {}
+pub fn a1423() void {}
+pub fn a1424() void {}
+pub fn a1425() void {}
+pub fn a1426() void {}
+pub fn a1427() void {}
+pub fn a1428() void {}
+pub fn a1429() void {}
+pub fn a1430() void {}
+pub fn a1431() void {}
+pub fn a1432() void {}
+pub fn a1433() void {}
+pub fn a1434() void {}
+pub fn a1435() void {}
+pub fn a1436() void {}
+pub fn a1437() void {}
+pub fn a1438() void {}
+pub fn a1439() void {}
+pub fn a1440() void {}
+pub fn a1441() void {}
+pub fn a1442() void {}
+pub fn a1443() void {}
+pub fn a1444() void {}
+pub fn a1445() void {}
+pub fn a1446() void {}
+pub fn a1447() void {}
+pub fn a1448() void {}
+pub fn a1449() void {}
+pub fn a1450() void {}
+pub fn a1451() void {}
+pub fn a1452() void {}
+pub fn a1453() void {}
+pub fn a1454() void {}
+pub fn a1455() void {}
+pub fn a1456() void {}
+pub fn a1457() void {}
+pub fn a1458() void {}
+pub fn a1459() void {}
+pub fn a1460() void {}
+pub fn a1461() void {}
+pub fn a1462() void {}
+pub fn a1463() void {}
+pub fn a1464() void {}
+pub fn a1465() void {}
+pub fn a1466() void {}
+pub fn a1467() void {}
+pub fn a1468() void {}
+pub fn a1469() void {}
+pub fn a1470() void {}
+pub fn a1471() void {}
+pub fn a1472() void {}
+pub fn a1473() void {}
+pub fn a1474() void {}
+pub fn a1475() void {}
+pub fn a1476() void {}
+pub fn a1477() void {}
+pub fn a1478() void {}
+pub fn a1479() void {}
+pub fn a1480() void {}
+pub fn a1481() void {}
+pub fn a1482() void {}
+pub fn a1483() void {}
+pub fn a1484() void {}
+pub fn a1485() void {}
+pub fn a1486() void {}
+pub fn a1487() void {}
+pub fn a1488() void {}
+pub fn a1489() void {}
+pub fn a1490() void {}
+pub fn a1491() void {}
+pub fn a1492() void {}
+pub fn a1493() void {}
+pub fn a1494() void {}
+pub fn a1495() void {}
+pub fn a1496() void {}
+pub fn a1497() void {}
+pub fn a1498() void {}
+pub fn a1499() void {}
+pub fn a1500() void {}
+pub fn a1501() void {}
+pub fn a1502() void {}
+pub fn a1503() void {}
+pub fn a1504() void {}
+pub fn a1505() void {}
+pub fn a1506() void {}
+pub fn a1507() void {}
+pub fn a1508() void {}
+pub fn a1509() void {}
+pub fn a1510() void {}
+pub fn a1511() void {}
+pub fn a1512() void {}
+pub fn a1513() void {}
+pub fn a1514() void {}
+pub fn a1515() void {}
+pub fn a1516() void {}
+pub fn a1517() void {}
+pub fn a1518() void {}
+pub fn a1519() void {}
+pub fn a1520() void {}
+pub fn a1521() void {}
+pub fn a1522() void {}
+pub fn a1523() void {}
+pub fn a1524() void {}
+pub fn a1525() void {}
+pub fn a1526() void {}
+pub fn a1527() void {}
+pub fn a1528() void {}
+pub fn a1529() void {}
+pub fn a1530() void {}
+pub fn a1531() void {}
+pub fn a1532() void {}
+pub fn a1533() void {}
+pub fn a1534() void {}
+pub fn a1535() void {}
+pub fn a1536() void {}
+pub fn a1537() void {}
+pub fn a1538() void {}
+pub fn a1539() void {}
+pub fn a1540() void {}
+pub fn a1541() void {}
+pub fn a1542() void {}
+pub fn a1543() void {}
+pub fn a1544() void {}
+pub fn a1545() void {}
+pub fn a1546() void {}
+pub fn a1547() void {}
+pub fn a1548() void {}
+pub fn a1549() void {}
+pub fn a1550() void {}
+pub fn a1551() void {}
+pub fn a1552() void {}
+pub fn a1553() void {}
+pub fn a1554() void {}
+pub fn a1555() void {}
+pub fn a1556() void {}
+pub fn a1557() void {}
+pub fn a1558() void {}
+pub fn a1559() void {}
+pub fn a1560() void {}
+pub fn a1561() void {}
+pub fn a1562() void {}
+pub fn a1563() void {}
+pub fn a1564() void {}
+pub fn a1565() void {}
+pub fn a1566() void {}
+pub fn a1567() void {}
+pub fn a1568() void {}
+pub fn a1569() void {}
+pub fn a1570() void {}
+pub fn a1571() void {}
+pub fn a1572() void {}
+pub fn a1573() void {}
+pub fn a1574() void {}
+pub fn a1575() void {}
+pub fn a1576() void {}
+pub fn a1577() void {}
+pub fn a1578() void {}
+pub fn a1579() void {}
+pub fn a1580() void {}
+pub fn a1581() void {}
+pub fn a1582() void {}
+pub fn a1583() void {}
+pub fn a1584() void {}
+pub fn a1585() void {}
+pub fn a1586() void {}
+pub fn a1587() void {}
+pub fn a1588() void {}
+pub fn a1589() void {}
+pub fn a1590() void {}
+pub fn a1591() void {}
+pub fn a1592() void {}
+pub fn a1593() void {}
+pub fn a1594() void {}
+pub fn a1595() void {}
+pub fn a1596() void {}
+pub fn a1597() void {}
+pub fn a1598() void {}
+pub fn a1599() void {}
+pub fn a1600() void {}
+pub fn a1601() void {}
+pub fn a1602() void {}
+pub fn a1603() void {}
+pub fn a1604() void {}
+pub fn a1605() void {}
+pub fn a1606() void {}
+pub fn a1607() void {}
+pub fn a1608() void {}
+pub fn a1609() void {}
+pub fn a1610() void {}
+pub fn a1611() void {}
+pub fn a1612() void {}
+pub fn a1613() void {}
+pub fn a1614() void {}
+pub fn a1615() void {}
+pub fn a1616() void {}
+pub fn a1617() void {}
+pub fn a1618() void {}
+pub fn a1619() void {}
+pub fn a1620() void {}
+pub fn a1621() void {}
+pub fn a1622() void {}
+pub fn a1623() void {}
+pub fn a1624() void {}
+pub fn a1625() void {}
+pub fn a1626() void {}
+pub fn a1627() void {}
+pub fn a1628() void {}
+pub fn a1629() void {}
+pub fn a1630() void {}
+pub fn a1631() void {}
+pub fn a1632() void {}
+pub fn a1633() void {}
+pub fn a1634() void {}
+pub fn a1635() void {}
+pub fn a1636() void {}
+pub fn a1637() void {}
+pub fn a1638() void {}
+pub fn a1639() void {}
+pub fn a1640() void {}
+pub fn a1641() void {}
+pub fn a1642() void {}
+pub fn a1643() void {}
+pub fn a1644() void {}
+pub fn a1645() void {}
+pub fn a1646() void {}
+pub fn a1647() void {}
+pub fn a1648() void {}
+pub fn a1649() void {}
+pub fn a1650() void {}
+pub fn a1651() void {}
+pub fn a1652() void {}
+pub fn a1653() void {}
+pub fn a1654() void {}
+pub fn a1655() void {}
+pub fn a1656() void {}
+pub fn a1657() void {}
+pub fn a1658() void {}
+pub fn a1659() void {}
+pub fn a1660() void {}
+pub fn a1661() void {}
+pub fn a1662() void {}
+pub fn a1663() void {}
+pub fn a1664() void {}
+pub fn a1665() void {}
+pub fn a1666() void {}
+pub fn a1667() void {}
+pub fn a1668() void {}
+pub fn a1669() void {}
+pub fn a1670() void {}
+pub fn a1671() void {}
+pub fn a1672() void {}
+pub fn a1673() void {}
+pub fn a1674() void {}
+pub fn a1675() void {}
+pub fn a1676() void {}
+pub fn a1677() void {}
+pub fn a1678() void {}
+pub fn a1679() void {}
+pub fn a1680() void {}
+pub fn a1681() void {}
+pub fn a1682() void {}
+pub fn a1683() void {}
+pub fn a1684() void {}
+pub fn a1685() void {}
+pub fn a1686() void {}
+pub fn a1687() void {}
+pub fn a1688() void {}
+pub fn a1689() void {}
+pub fn a1690() void {}
+pub fn a1691() void {}
+pub fn a1692() void {}
+pub fn a1693() void {}
+pub fn a1694() void {}
+pub fn a1695() void {}
+pub fn a1696() void {}
+pub fn a1697() void {}
+pub fn a1698() void {}
+pub fn a1699() void {}
+pub fn a1700() void {}
+pub fn a1701() void {}
+pub fn a1702() void {}
+pub fn a1703() void {}
+pub fn a1704() void {}
+pub fn a1705() void {}
+pub fn a1706() void {}
+pub fn a1707() void {}
+pub fn a1708() void {}
+pub fn a1709() void {}
+pub fn a1710() void {}
+pub fn a1711() void {}
+pub fn a1712() void {}
+pub fn a1713() void {}
+pub fn a1714() void {}
+pub fn a1715() void {}
+pub fn a1716() void {}
+pub fn a1717() void {}
+pub fn a1718() void {}
+pub fn a1719() void {}
+pub fn a1720() void {}
+pub fn a1721() void {}
+pub fn a1722() void {}
+pub fn a1723() void {}
+pub fn a1724() void {}
+pub fn a1725() void {}
+pub fn a1726() void {}
+pub fn a1727() void {}
+pub fn a1728() void {}
+pub fn a1729() void {}
+pub fn a1730() void {}
+pub fn a1731() void {}
+pub fn a1732() void {}
+pub fn a1733() void {}
+pub fn a1734() void {}
+pub fn a1735() void {}
+pub fn a1736() void {}
+pub fn a1737() void {}
+pub fn a1738() void {}
+pub fn a1739() void {}
+pub fn a1740() void {}
+pub fn a1741() void {}
+pub fn a1742() void {}
+pub fn a1743() void {}
+pub fn a1744() void {}
+pub fn a1745() void {}
+pub fn a1746() void {}
+pub fn a1747() void {}
+pub fn a1748() void {}
+pub fn a1749() void {}
+pub fn a1750() void {}
+pub fn a1751() void {}
+pub fn a1752() void {}
+pub fn a1753() void {}
+pub fn a1754() void {}
+pub fn a1755() void {}
+pub fn a1756() void {}
+pub fn a1757() void {}
+pub fn a1758() void {}
+pub fn a1759() void {}
+pub fn a1760() void {}
+pub fn a1761() void {}
+pub fn a1762() void {}
+pub fn a1763() void {}
+pub fn a1764() void {}
+pub fn a1765() void {}
+pub fn a1766() void {}
+pub fn a1767() void {}
+pub fn a1768() void {}
+pub fn a1769() void {}
+pub fn a1770() void {}
+pub fn a1771() void {}
+pub fn a1772() void {}
+pub fn a1773() void {}
+pub fn a1774() void {}
+pub fn a1775() void {}
+pub fn a1776() void {}
+pub fn a1777() void {}
+pub fn a1778() void {}
+pub fn a1779() void {}
+pub fn a1780() void {}
+pub fn a1781() void {}
+pub fn a1782() void {}
+pub fn a1783() void {}
+pub fn a1784() void {}
+pub fn a1785() void {}
+pub fn a1786() void {}
+pub fn a1787() void {}
+pub fn a1788() void {}
+pub fn a1789() void {}
+pub fn a1790() void {}
+pub fn a1791() void {}
+pub fn a1792() void {}
+pub fn a1793() void {}
+pub fn a1794() void {}
+pub fn a1795() void {}
+pub fn a1796() void {}
+pub fn a1797() void {}
+pub fn a1798() void {}
+pub fn a1799() void {}
+pub fn a1800() void {}
+pub fn a1801() void {}
+pub fn a1802() void {}
+pub fn a1803() void {}
+pub fn a1804() void {}
+pub fn a1805() void {}
+pub fn a1806() void {}
+pub fn a1807() void {}
+pub fn a1808() void {}
+pub fn a1809() void {}
+pub fn a1810() void {}
+pub fn a1811() void {}
+pub fn a1812() void {}
+pub fn a1813() void {}
+pub fn a1814() void {}
+pub fn a1815() void {}
+pub fn a1816() void {}
+pub fn a1817() void {}
+pub fn a1818() void {}
+pub fn a1819() void {}
+pub fn a1820() void {}
+pub fn a1821() void {}
+pub fn a1822() void {}
+pub fn a1823() void {}
+pub fn a1824() void {}
+pub fn a1825() void {}
+pub fn a1826() void {}
+pub fn a1827() void {}
+pub fn a1828() void {}
+pub fn a1829() void {}
+pub fn a1830() void {}
+pub fn a1831() void {}
+pub fn a1832() void {}
+pub fn a1833() void {}
+pub fn a1834() void {}
+pub fn a1835() void {}
+pub fn a1836() void {}
+pub fn a1837() void {}
+pub fn a1838() void {}
+pub fn a1839() void {}
+pub fn a1840() void {}
+pub fn a1841() void {}
+pub fn a1842() void {}
+pub fn a1843() void {}
+pub fn a1844() void {}
+pub fn a1845() void {}
+pub fn a1846() void {}
+pub fn a1847() void {}
+pub fn a1848() void {}
+pub fn a1849() void {}
+pub fn a1850() void {}
+pub fn a1851() void {}
+pub fn a1852() void {}
+pub fn a1853() void {}
+pub fn a1854() void {}
+pub fn a1855() void {}
+pub fn a1856() void {}
+pub fn a1857() void {}
+pub fn a1858() void {}
+pub fn a1859() void {}
+pub fn a1860() void {}
+pub fn a1861() void {}
+pub fn a1862() void {}
+pub fn a1863() void {}
+pub fn a1864() void {}
+pub fn a1865() void {}
+pub fn a1866() void {}
+pub fn a1867() void {}
+pub fn a1868() void {}
+pub fn a1869() void {}
+pub fn a1870() void {}
+pub fn a1871() void {}
+pub fn a1872() void {}
+pub fn a1873() void {}
+pub fn a1874() void {}
+pub fn a1875() void {}
+pub fn a1876() void {}
+pub fn a1877() void {}
+pub fn a1878() void {}
+pub fn a1879() void {}
+pub fn a1880() void {}
+pub fn a1881() void {}
+pub fn a1882() void {}
+pub fn a1883() void {}
+pub fn a1884() void {}
+pub fn a1885() void {}
+pub fn a1886() void {}
+pub fn a1887() void {}
+pub fn a1888() void {}
+pub fn a1889() void {}
+pub fn a1890() void {}
+pub fn a1891() void {}
+pub fn a1892() void {}
+pub fn a1893() void {}
+pub fn a1894() void {}
+pub fn a1895() void {}
+pub fn a1896() void {}
+pub fn a1897() void {}
+pub fn a1898() void {}
+pub fn a1899() void {}
+pub fn a1900() void {}
+pub fn a1901() void {}
+pub fn a1902() void {}
+pub fn a1903() void {}
+pub fn a1904() void {}
+pub fn a1905() void {}
+pub fn a1906() void {}
+pub fn a1907() void {}
+pub fn a1908() void {}
+pub fn a1909() void {}
+pub fn a1910() void {}
+pub fn a1911() void {}
+pub fn a1912() void {}
+pub fn a1913() void {}
+pub fn a1914() void {}
+pub fn a1915() void {}
+pub fn a1916() void {}
+pub fn a1917() void {}
+pub fn a1918() void {}
+pub fn a1919() void {}
+pub fn a1920() void {}
+pub fn a1921() void {}
+pub fn a1922() void {}
+pub fn a1923() void {}
+pub fn a1924() void {}
+pub fn a1925() void {}
+pub fn a1926() void {}
+pub fn a1927() void {}
+pub fn a1928() void {}
+pub fn a1929() void {}
+pub fn a1930() void {}
+pub fn a1931() void {}
+pub fn a1932() void {}
+pub fn a1933() void {}
+pub fn a1934() void {}
+pub fn a1935() void {}
+pub fn a1936() void {}
+pub fn a1937() void {}
+pub fn a1938() void {}
+pub fn a1939() void {}
+pub fn a1940() void {}
+pub fn a1941() void {}
+pub fn a1942() void {}
+pub fn a1943() void {}
+pub fn a1944() void {}
+pub fn a1945() void {}
+pub fn a1946() void {}
+pub fn a1947() void {}
+pub fn a1948() void {}
+pub fn a1949() void {}
+pub fn a1950() void {}
+pub fn a1951() void {}
+pub fn a1952() void {}
+pub fn a1953() void {}
+pub fn a1954() void {}
+pub fn a1955() void {}
+pub fn a1956() void {}
+pub fn a1957() void {}
+pub fn a1958() void {}
+pub fn a1959() void {}
+pub fn a1960() void {}
+pub fn a1961() void {}
+pub fn a1962() void {}
+pub fn a1963() void {}
+pub fn a1964() void {}
+pub fn a1965() void {}
+pub fn a1966() void {}
+pub fn a1967() void {}
+pub fn a1968() void {}
+pub fn a1969() void {}
+pub fn a1970() void {}
+pub fn a1971() void {}
+pub fn a1972() void {}
+pub fn a1973() void {}
+pub fn a1974() void {}
+pub fn a1975() void {}
+pub fn a1976() void {}
+pub fn a1977() void {}
+pub fn a1978() void {}
+pub fn a1979() void {}
+pub fn a1980() void {}
+pub fn a1981() void {}
+pub fn a1982() void {}
+pub fn a1983() void {}
+pub fn a1984() void {}
+pub fn a1985() void {}
+pub fn a1986() void {}
+pub fn a1987() void {}
+pub fn a1988() void {}
+pub fn a1989() void {}
+pub fn a1990() void {}
+pub fn a1991() void {}
+pub fn a1992() void {}
+pub fn a1993() void {}
+pub fn a1994() void {}
+pub fn a1995() void {}
+pub fn a1996() void {}
+pub fn a1997() void {}
+pub fn a1998() void {}
+pub fn a1999() void {}
+pub fn a2000() void {}
+pub fn a2001() void {}
+pub fn a2002() void {}
+pub fn a2003() void {}
+pub fn a2004() void {}
+pub fn a2005() void {}
+pub fn a2006() void {}
+pub fn a2007() void {}
+pub fn a2008() void {}
+pub fn a2009() void {}
+pub fn a2010() void {}
+pub fn a2011() void {}
+pub fn a2012() void {}
+pub fn a2013() void {}
+pub fn a2014() void {}
+pub fn a2015() void {}
+pub fn a2016() void {}
+pub fn a2017() void {}
+pub fn a2018() void {}
+pub fn a2019() void {}
+pub fn a2020() void {}
+pub fn a2021() void {}
+pub fn a2022() void {}
+pub fn a2023() void {}
+pub fn a2024() void {}
+pub fn a2025() void {}
+pub fn a2026() void {}
+pub fn a2027() void {}
+pub fn a2028() void {}
+pub fn a2029() void {}
+pub fn a2030() void {}
+pub fn a2031() void {}
+pub fn a2032() void {}
+pub fn a2033() void {}
+pub fn a2034() void {}
+pub fn a2035() void {}
+pub fn a2036() void {}
+pub fn a2037() void {}
+pub fn a2038() void {}
+pub fn a2039() void {}
+pub fn a2040() void {}
+pub fn a2041() void {}
+pub fn a2042() void {}
+pub fn a2043() void {}
+pub fn a2044() void {}
+pub fn a2045() void {}
+pub fn a2046() void {}
+pub fn a2047() void {}
+pub fn a2048() void {}
+pub fn a2049() void {}
+pub fn a2050() void {}
+pub fn a2051() void {}
+pub fn a2052() void {}
+pub fn a2053() void {}
+pub fn a2054() void {}
+pub fn a2055() void {}
+pub fn a2056() void {}
+pub fn a2057() void {}
+pub fn a2058() void {}
+pub fn a2059() void {}
+pub fn a2060() void {}
+pub fn a2061() void {}
+pub fn a2062() void {}
+pub fn a2063() void {}
+pub fn a2064() void {}
+pub fn a2065() void {}
+pub fn a2066() void {}
+pub fn a2067() void {}
+pub fn a2068() void {}
+pub fn a2069() void {}
+pub fn a2070() void {}
+pub fn a2071() void {}
+pub fn a2072() void {}
+pub fn a2073() void {}
+pub fn a2074() void {}
+pub fn a2075() void {}
+pub fn a2076() void {}
+pub fn a2077() void {}
+pub fn a2078() void {}
+pub fn a2079() void {}
+pub fn a2080() void {}
+pub fn a2081() void {}
+pub fn a2082() void {}
+pub fn a2083() void {}
+pub fn a2084() void {}
+pub fn a2085() void {}
+pub fn a2086() void {}
+pub fn a2087() void {}
+pub fn a2088() void {}
+pub fn a2089() void {}
+pub fn a2090() void {}
+pub fn a2091() void {}
+pub fn a2092() void {}
+pub fn a2093() void {}
+pub fn a2094() void {}
+pub fn a2095() void {}
+pub fn a2096() void {}
+pub fn a2097() void {}
+pub fn a2098() void {}
+pub fn a2099() void {}
+pub fn a2100() void {}
+pub fn a2101() void {}
+pub fn a2102() void {}
+pub fn a2103() void {}
+pub fn a2104() void {}
+pub fn a2105() void {}
+pub fn a2106() void {}
+pub fn a2107() void {}
+pub fn a2108() void {}
+pub fn a2109() void {}
+pub fn a2110() void {}
+pub fn a2111() void {}
+pub fn a2112() void {}
+pub fn a2113() void {}
+pub fn a2114() void {}
+pub fn a2115() void {}
+pub fn a2116() void {}
+pub fn a2117() void {}
+pub fn a2118() void {}
+pub fn a2119() void {}
+pub fn a2120() void {}
+pub fn a2121() void {}
+pub fn a2122() void {}
+pub fn a2123() void {}
+pub fn a2124() void {}
+pub fn a2125() void {}
+pub fn a2126() void {}
+pub fn a2127() void {}
+pub fn a2128() void {}
+pub fn a2129() void {}
+pub fn a2130() void {}
+pub fn a2131() void {}
+pub fn a2132() void {}
+pub fn a2133() void {}
+pub fn a2134() void {}
+pub fn a2135() void {}
+pub fn a2136() void {}
+pub fn a2137() void {}
+pub fn a2138() void {}
+pub fn a2139() void {}
+pub fn a2140() void {}
+pub fn a2141() void {}
+pub fn a2142() void {}
+pub fn a2143() void {}
+pub fn a2144() void {}
+pub fn a2145() void {}
+pub fn a2146() void {}
+pub fn a2147() void {}
+pub fn a2148() void {}
+pub fn a2149() void {}
+pub fn a2150() void {}
+pub fn a2151() void {}
+pub fn a2152() void {}
+pub fn a2153() void {}
+pub fn a2154() void {}
+pub fn a2155() void {}
+pub fn a2156() void {}
+pub fn a2157() void {}
+pub fn a2158() void {}
+pub fn a2159() void {}
+pub fn a2160() void {}
+pub fn a2161() void {}
+pub fn a2162() void {}
+pub fn a2163() void {}
+pub fn a2164() void {}
+pub fn a2165() void {}
+pub fn a2166() void {}
+pub fn a2167() void {}
+pub fn a2168() void {}
+pub fn a2169() void {}
+pub fn a2170() void {}
+pub fn a2171() void {}
+pub fn a2172() void {}
+pub fn a2173() void {}
+pub fn a2174() void {}
+pub fn a2175() void {}
+pub fn a2176() void {}
+pub fn a2177() void {}
+pub fn a2178() void {}
+pub fn a2179() void {}
+pub fn a2180() void {}
+pub fn a2181() void {}
+pub fn a2182() void {}
+pub fn a2183() void {}
+pub fn a2184() void {}
+pub fn a2185() void {}
+pub fn a2186() void {}
+pub fn a2187() void {}
+pub fn a2188() void {}
+pub fn a2189() void {}
+pub fn a2190() void {}
+pub fn a2191() void {}
+pub fn a2192() void {}
+pub fn a2193() void {}
+pub fn a2194() void {}
+pub fn a2195() void {}
+pub fn a2196() void {}
+pub fn a2197() void {}
+pub fn a2198() void {}
+pub fn a2199() void {}
+pub fn a2200() void {}
+pub fn a2201() void {}
+pub fn a2202() void {}
+pub fn a2203() void {}
+pub fn a2204() void {}
+pub fn a2205() void {}
+pub fn a2206() void {}
+pub fn a2207() void {}
+pub fn a2208() void {}
+pub fn a2209() void {}
+pub fn a2210() void {}
+pub fn a2211() void {}
+pub fn a2212() void {}
+pub fn a2213() void {}
+pub fn a2214() void {}
+pub fn a2215() void {}
+pub fn a2216() void {}
+pub fn a2217() void {}
+pub fn a2218() void {}
+pub fn a2219() void {}
+pub fn a2220() void {}
+pub fn a2221() void {}
+pub fn a2222() void {}
+pub fn a2223() void {}
+pub fn a2224() void {}
+pub fn a2225() void {}
+pub fn a2226() void {}
+pub fn a2227() void {}
+pub fn a2228() void {}
+pub fn a2229() void {}
+pub fn a2230() void {}
+pub fn a2231() void {}
+pub fn a2232() void {}
+pub fn a2233() void {}
+pub fn a2234() void {}
+pub fn a2235() void {}
+pub fn a2236() void {}
+pub fn a2237() void {}
+pub fn a2238() void {}
+pub fn a2239() void {}
+pub fn a2240() void {}
+pub fn a2241() void {}
+pub fn a2242() void {}
+pub fn a2243() void {}
+pub fn a2244() void {}
+pub fn a2245() void {}
+pub fn a2246() void {}
+pub fn a2247() void {}
+pub fn a2248() void {}
+pub fn a2249() void {}
+pub fn a2250() void {}
+pub fn a2251() void {}
+pub fn a2252() void {}
+pub fn a2253() void {}
+pub fn a2254() void {}
+pub fn a2255() void {}
+pub fn a2256() void {}
+pub fn a2257() void {}
+pub fn a2258() void {}
+pub fn a2259() void {}
+pub fn a2260() void {}
+pub fn a2261() void {}
+pub fn a2262() void {}
+pub fn a2263() void {}
+pub fn a2264() void {}
+pub fn a2265() void {}
+pub fn a2266() void {}
+pub fn a2267() void {}
+pub fn a2268() void {}
+pub fn a2269() void {}
+pub fn a2270() void {}
+pub fn a2271() void {}
+pub fn a2272() void {}
+pub fn a2273() void {}
+pub fn a2274() void {}
+pub fn a2275() void {}
+pub fn a2276() void {}
+pub fn a2277() void {}
+pub fn a2278() void {}
+pub fn a2279() void {}
+pub fn a2280() void {}
+pub fn a2281() void {}
+pub fn a2282() void {}
+pub fn a2283() void {}
+pub fn a2284() void {}
+pub fn a2285() void {}
+pub fn a2286() void {}
+pub fn a2287() void {}
+pub fn a2288() void {}
+pub fn a2289() void {}
+pub fn a2290() void {}
+pub fn a2291() void {}
+pub fn a2292() void {}
+pub fn a2293() void {}
+pub fn a2294() void {}
+pub fn a2295() void {}
+pub fn a2296() void {}
+pub fn a2297() void {}
+pub fn a2298() void {}
+pub fn a2299() void {}
+pub fn a2300() void {}
+pub fn a2301() void {}
+pub fn a2302() void {}
+pub fn a2303() void {}
+pub fn a2304() void {}
+pub fn a2305() void {}
+pub fn a2306() void {}
+pub fn a2307() void {}
+pub fn a2308() void {}
+pub fn a2309() void {}
+pub fn a2310() void {}
+pub fn a2311() void {}
+pub fn a2312() void {}
+pub fn a2313() void {}
+pub fn a2314() void {}
+pub fn a2315() void {}
+pub fn a2316() void {}
+pub fn a2317() void {}
+pub fn a2318() void {}
+pub fn a2319() void {}
+pub fn a2320() void {}
+pub fn a2321() void {}
+pub fn a2322() void {}
+pub fn a2323() void {}
+pub fn a2324() void {}
+pub fn a2325() void {}
+pub fn a2326() void {}
+pub fn a2327() void {}
+pub fn a2328() void {}
+pub fn a2329() void {}
+pub fn a2330() void {}
+pub fn a2331() void {}
+pub fn a2332() void {}
+pub fn a2333() void {}
+pub fn a2334() void {}
+pub fn a2335() void {}
+pub fn a2336() void {}
+pub fn a2337() void {}
+pub fn a2338() void {}
+pub fn a2339() void {}
+pub fn a2340() void {}
+pub fn a2341() void {}
+pub fn a2342() void {}
+pub fn a2343() void {}
+pub fn a2344() void {}
+pub fn a2345() void {}
+pub fn a2346() void {}
+pub fn a2347() void {}
+pub fn a2348() void {}
+pub fn a2349() void {}
+pub fn a2350() void {}
+pub fn a2351() void {}
+pub fn a2352() void {}
+pub fn a2353() void {}
+pub fn a2354() void {}
+pub fn a2355() void {}
+pub fn a2356() void {}
+pub fn a2357() void {}
+pub fn a2358() void {}
+pub fn a2359() void {}
+pub fn a2360() void {}
+pub fn a2361() void {}
+pub fn a2362() void {}
+pub fn a2363() void {}
+pub fn a2364() void {}
+pub fn a2365() void {}
+pub fn a2366() void {}
+pub fn a2367() void {}
+pub fn a2368() void {}
+pub fn a2369() void {}
+pub fn a2370() void {}
+pub fn a2371() void {}
+pub fn a2372() void {}
+pub fn a2373() void {}
+pub fn a2374() void {}
+pub fn a2375() void {}
+pub fn a2376() void {}
+pub fn a2377() void {}
+pub fn a2378() void {}
+pub fn a2379() void {}
+pub fn a2380() void {}
+pub fn a2381() void {}
+pub fn a2382() void {}
+pub fn a2383() void {}
+pub fn a2384() void {}
+pub fn a2385() void {}
+pub fn a2386() void {}
+pub fn a2387() void {}
+pub fn a2388() void {}
+pub fn a2389() void {}
+pub fn a2390() void {}
+pub fn a2391() void {}
+pub fn a2392() void {}
+pub fn a2393() void {}
+pub fn a2394() void {}
+pub fn a2395() void {}
+pub fn a2396() void {}
+pub fn a2397() void {}
+pub fn a2398() void {}
+pub fn a2399() void {}
+pub fn a2400() void {}
+pub fn a2401() void {}
+pub fn a2402() void {}
+pub fn a2403() void {}
+pub fn a2404() void {}
+pub fn a2405() void {}
+pub fn a2406() void {}
+pub fn a2407() void {}
+pub fn a2408() void {}
+pub fn a2409() void {}
+pub fn a2410() void {}
+pub fn a2411() void {}
+pub fn a2412() void {}
+pub fn a2413() void {}
+pub fn a2414() void {}
+pub fn a2415() void {}
+pub fn a2416() void {}
+pub fn a2417() void {}
+pub fn a2418() void {}
+pub fn a2419() void {}
+pub fn a2420() void {}
+pub fn a2421() void {}
+pub fn a2422() void {}
+pub fn a2423() void {}
+pub fn a2424() void {}
+pub fn a2425() void {}
+pub fn a2426() void {}
+pub fn a2427() void {}
+pub fn a2428() void {}
+pub fn a2429() void {}
+pub fn a2430() void {}
+pub fn a2431() void {}
+pub fn a2432() void {}
+pub fn a2433() void {}
+pub fn a2434() void {}
+pub fn a2435() void {}
+pub fn a2436() void {}
+pub fn a2437() void {}
+pub fn a2438() void {}
+pub fn a2439() void {}
+pub fn a2440() void {}
+pub fn a2441() void {}
+pub fn a2442() void {}
+pub fn a2443() void {}
+pub fn a2444() void {}
+pub fn a2445() void {}
+pub fn a2446() void {}
+pub fn a2447() void {}
+pub fn a2448() void {}
+pub fn a2449() void {}
+pub fn a2450() void {}
+pub fn a2451() void {}
+pub fn a2452() void {}
+pub fn a2453() void {}
+pub fn a2454() void {}
+pub fn a2455() void {}
+pub fn a2456() void {}
+pub fn a2457() void {}
+pub fn a2458() void {}
+pub fn a2459() void {}
+pub fn a2460() void {}
+pub fn a2461() void {}
+pub fn a2462() void {}
+pub fn a2463() void {}
+pub fn a2464() void {}
+pub fn a2465() void {}
+pub fn a2466() void {}
+pub fn a2467() void {}
+pub fn a2468() void {}
+pub fn a2469() void {}
+pub fn a2470() void {}
+pub fn a2471() void {}
+pub fn a2472() void {}
+pub fn a2473() void {}
+pub fn a2474() void {}
+pub fn a2475() void {}
+pub fn a2476() void {}
+pub fn a2477() void {}
+pub fn a2478() void {}
+pub fn a2479() void {}
+pub fn a2480() void {}
+pub fn a2481() void {}
+pub fn a2482() void {}
+pub fn a2483() void {}
+pub fn a2484() void {}
+pub fn a2485() void {}
+pub fn a2486() void {}
+pub fn a2487() void {}
+pub fn a2488() void {}
+pub fn a2489() void {}
+pub fn a2490() void {}
+pub fn a2491() void {}
+pub fn a2492() void {}
+pub fn a2493() void {}
+pub fn a2494() void {}
+pub fn a2495() void {}
+pub fn a2496() void {}
+pub fn a2497() void {}
+pub fn a2498() void {}
+pub fn a2499() void {}
+pub fn a2500() void {}
+pub fn a2501() void {}
+pub fn a2502() void {}
+pub fn a2503() void {}
+pub fn a2504() void {}
+pub fn a2505() void {}
+pub fn a2506() void {}
+pub fn a2507() void {}
+pub fn a2508() void {}
+pub fn a2509() void {}
+pub fn a2510() void {}
+pub fn a2511() void {}
+pub fn a2512() void {}
+pub fn a2513() void {}
+pub fn a2514() void {}
+pub fn a2515() void {}
+pub fn a2516() void {}
+pub fn a2517() void {}
+pub fn a2518() void {}
+pub fn a2519() void {}
+pub fn a2520() void {}
+pub fn a2521() void {}
+pub fn a2522() void {}
+pub fn a2523() void {}
+pub fn a2524() void {}
+pub fn a2525() void {}
+pub fn a2526() void {}
+pub fn a2527() void {}
+pub fn a2528() void {}
+pub fn a2529() void {}
+pub fn a2530() void {}
+pub fn a2531() void {}
+pub fn a2532() void {}
+pub fn a2533() void {}
+pub fn a2534() void {}
+pub fn a2535() void {}
+pub fn a2536() void {}
+pub fn a2537() void {}
+pub fn a2538() void {}
+pub fn a2539() void {}
+pub fn a2540() void {}
+pub fn a2541() void {}
+pub fn a2542() void {}
+pub fn a2543() void {}
+pub fn a2544() void {}
+pub fn a2545() void {}
+pub fn a2546() void {}
+pub fn a2547() void {}
+pub fn a2548() void {}
+pub fn a2549() void {}
+pub fn a2550() void {}
+pub fn a2551() void {}
+pub fn a2552() void {}
+pub fn a2553() void {}
+pub fn a2554() void {}
+pub fn a2555() void {}
+pub fn a2556() void {}
+pub fn a2557() void {}
+pub fn a2558() void {}
+pub fn a2559() void {}
+pub fn a2560() void {}
+pub fn a2561() void {}
+pub fn a2562() void {}
+pub fn a2563() void {}
+pub fn a2564() void {}
+pub fn a2565() void {}
+pub fn a2566() void {}
+pub fn a2567() void {}
+pub fn a2568() void {}
+pub fn a2569() void {}
+pub fn a2570() void {}
+pub fn a2571() void {}
+pub fn a2572() void {}
+pub fn a2573() void {}
+pub fn a2574() void {}
+pub fn a2575() void {}
+pub fn a2576() void {}
+pub fn a2577() void {}
+pub fn a2578() void {}
+pub fn a2579() void {}
+pub fn a2580() void {}
+pub fn a2581() void {}
+pub fn a2582() void {}
+pub fn a2583() void {}
+pub fn a2584() void {}
+pub fn a2585() void {}
+pub fn a2586() void {}
+pub fn a2587() void {}
+pub fn a2588() void {}
+pub fn a2589() void {}
+pub fn a2590() void {}
+pub fn a2591() void {}
+pub fn a2592() void {}
+pub fn a2593() void {}
+pub fn a2594() void {}
+pub fn a2595() void {}
+pub fn a2596() void {}
+pub fn a2597() void {}
+pub fn a2598() void {}
+pub fn a2599() void {}
+pub fn a2600() void {}
+pub fn a2601() void {}
+pub fn a2602() void {}
+pub fn a2603() void {}
+pub fn a2604() void {}
+pub fn a2605() void {}
+pub fn a2606() void {}
+pub fn a2607() void {}
+pub fn a2608() void {}
+pub fn a2609() void {}
+pub fn a2610() void {}
+pub fn a2611() void {}
+pub fn a2612() void {}
+pub fn a2613() void {}
+pub fn a2614() void {}
+pub fn a2615() void {}
+pub fn a2616() void {}
+pub fn a2617() void {}
+pub fn a2618() void {}
+pub fn a2619() void {}
+pub fn a2620() void {}
+pub fn a2621() void {}
+pub fn a2622() void {}
+pub fn a2623() void {}
+pub fn a2624() void {}
+pub fn a2625() void {}
+pub fn a2626() void {}
+pub fn a2627() void {}
+pub fn a2628() void {}
+pub fn a2629() void {}
+pub fn a2630() void {}
+pub fn a2631() void {}
+pub fn a2632() void {}
+pub fn a2633() void {}
+pub fn a2634() void {}
+pub fn a2635() void {}
+pub fn a2636() void {}
+pub fn a2637() void {}
+pub fn a2638() void {}
+pub fn a2639() void {}
+pub fn a2640() void {}
+pub fn a2641() void {}
+pub fn a2642() void {}
+pub fn a2643() void {}
+pub fn a2644() void {}
+pub fn a2645() void {}
+pub fn a2646() void {}
+pub fn a2647() void {}
+pub fn a2648() void {}
+pub fn a2649() void {}
+pub fn a2650() void {}
+pub fn a2651() void {}
+pub fn a2652() void {}
+pub fn a2653() void {}
+pub fn a2654() void {}
+pub fn a2655() void {}
+pub fn a2656() void {}
+pub fn a2657() void {}
+pub fn a2658() void {}
+pub fn a2659() void {}
+pub fn a2660() void {}
+pub fn a2661() void {}
+pub fn a2662() void {}
+pub fn a2663() void {}
+pub fn a2664() void {}
+pub fn a2665() void {}
+pub fn a2666() void {}
+pub fn a2667() void {}
+pub fn a2668() void {}
+pub fn a2669() void {}
+pub fn a2670() void {}
+pub fn a2671() void {}
+pub fn a2672() void {}
+pub fn a2673() void {}
+pub fn a2674() void {}
+pub fn a2675() void {}
+pub fn a2676() void {}
+pub fn a2677() void {}
+pub fn a2678() void {}
+pub fn a2679() void {}
+pub fn a2680() void {}
+pub fn a2681() void {}
+pub fn a2682() void {}
+pub fn a2683() void {}
+pub fn a2684() void {}
+pub fn a2685() void {}
+pub fn a2686() void {}
+pub fn a2687() void {}
+pub fn a2688() void {}
+pub fn a2689() void {}
+pub fn a2690() void {}
+pub fn a2691() void {}
+pub fn a2692() void {}
+pub fn a2693() void {}
+pub fn a2694() void {}
+pub fn a2695() void {}
+pub fn a2696() void {}
+pub fn a2697() void {}
+pub fn a2698() void {}
+pub fn a2699() void {}
+pub fn a2700() void {}
+pub fn a2701() void {}
+pub fn a2702() void {}
+pub fn a2703() void {}
+pub fn a2704() void {}
+pub fn a2705() void {}
+pub fn a2706() void {}
+pub fn a2707() void {}
+pub fn a2708() void {}
+pub fn a2709() void {}
+pub fn a2710() void {}
+pub fn a2711() void {}
+pub fn a2712() void {}
+pub fn a2713() void {}
+pub fn a2714() void {}
+pub fn a2715() void {}
+pub fn a2716() void {}
+pub fn a2717() void {}
+pub fn a2718() void {}
+pub fn a2719() void {}
+pub fn a2720() void {}
+pub fn a2721() void {}
+pub fn a2722() void {}
+pub fn a2723() void {}
+pub fn a2724() void {}
+pub fn a2725() void {}
+pub fn a2726() void {}
+pub fn a2727() void {}
+pub fn a2728() void {}
+pub fn a2729() void {}
+pub fn a2730() void {}
+pub fn a2731() void {}
+pub fn a2732() void {}
+pub fn a2733() void {}
+pub fn a2734() void {}
+pub fn a2735() void {}
+pub fn a2736() void {}
+pub fn a2737() void {}
+pub fn a2738() void {}
+pub fn a2739() void {}
+pub fn a2740() void {}
+pub fn a2741() void {}
+pub fn a2742() void {}
+pub fn a2743() void {}
+pub fn a2744() void {}
+pub fn a2745() void {}
+pub fn a2746() void {}
+pub fn a2747() void {}
+pub fn a2748() void {}
+pub fn a2749() void {}
+pub fn a2750() void {}
+pub fn a2751() void {}
+pub fn a2752() void {}
+pub fn a2753() void {}
+pub fn a2754() void {}
+pub fn a2755() void {}
+pub fn a2756() void {}
+pub fn a2757() void {}
+pub fn a2758() void {}
+pub fn a2759() void {}
+pub fn a2760() void {}
+pub fn a2761() void {}
+pub fn a2762() void {}
+pub fn a2763() void {}
+pub fn a2764() void {}
+pub fn a2765() void {}
+pub fn a2766() void {}
+pub fn a2767() void {}
+pub fn a2768() void {}
+pub fn a2769() void {}
+pub fn a2770() void {}
+pub fn a2771() void {}
+pub fn a2772() void {}
+pub fn a2773() void {}
+pub fn a2774() void {}
+pub fn a2775() void {}
+pub fn a2776() void {}
+pub fn a2777() void {}
+pub fn a2778() void {}
+pub fn a2779() void {}
+pub fn a2780() void {}
+pub fn a2781() void {}
+pub fn a2782() void {}
+pub fn a2783() void {}
+pub fn a2784() void {}
+pub fn a2785() void {}
+pub fn a2786() void {}
+pub fn a2787() void {}
+pub fn a2788() void {}
+pub fn a2789() void {}
+pub fn a2790() void {}
+pub fn a2791() void {}
+pub fn a2792() void {}
+pub fn a2793() void {}
+pub fn a2794() void {}
+pub fn a2795() void {}
+pub fn a2796() void {}
+pub fn a2797() void {}
+pub fn a2798() void {}
+pub fn a2799() void {}
+pub fn a2800() void {}
+pub fn a2801() void {}
+pub fn a2802() void {}
+pub fn a2803() void {}
+pub fn a2804() void {}
+pub fn a2805() void {}
+pub fn a2806() void {}
+pub fn a2807() void {}
+pub fn a2808() void {}
+pub fn a2809() void {}
+pub fn a2810() void {}
+pub fn a2811() void {}
+pub fn a2812() void {}
+pub fn a2813() void {}
+pub fn a2814() void {}
+pub fn a2815() void {}
+pub fn a2816() void {}
+pub fn a2817() void {}
+pub fn a2818() void {}
+pub fn a2819() void {}
+pub fn a2820() void {}
+pub fn a2821() void {}
+pub fn a2822() void {}
+pub fn a2823() void {}
+pub fn a2824() void {}
+pub fn a2825() void {}
+pub fn a2826() void {}
+pub fn a2827() void {}
+pub fn a2828() void {}
+pub fn a2829() void {}
+pub fn a2830() void {}
+pub fn a2831() void {}
+pub fn a2832() void {}
+pub fn a2833() void {}
+pub fn a2834() void {}
+pub fn a2835() void {}
+pub fn a2836() void {}
+pub fn a2837() void {}
+pub fn a2838() void {}
+pub fn a2839() void {}
+pub fn a2840() void {}
+pub fn a2841() void {}
+pub fn a2842() void {}
+pub fn a2843() void {}
+pub fn a2844() void {}
+pub fn a2845() void {}
+pub fn a2846() void {}
+pub fn a2847() void {}
+pub fn a2848() void {}
+pub fn a2849() void {}
+pub fn a2850() void {}
+pub fn a2851() void {}
+pub fn a2852() void {}
+pub fn a2853() void {}
+pub fn a2854() void {}
+pub fn a2855() void {}
+pub fn a2856() void {}
+pub fn a2857() void {}
+pub fn a2858() void {}
+pub fn a2859() void {}
+pub fn a2860() void {}
+pub fn a2861() void {}
+pub fn a2862() void {}
+pub fn a2863() void {}
+pub fn a2864() void {}
+pub fn a2865() void {}
+pub fn a2866() void {}
+pub fn a2867() void {}
+pub fn a2868() void {}
+pub fn a2869() void {}
+pub fn a2870() void {}
+pub fn a2871() void {}
+pub fn a2872() void {}
+pub fn a2873() void {}
+pub fn a2874() void {}
+pub fn a2875() void {}
+pub fn a2876() void {}
+pub fn a2877() void {}
+pub fn a2878() void {}
+pub fn a2879() void {}
+pub fn a2880() void {}
+pub fn a2881() void {}
+pub fn a2882() void {}
+pub fn a2883() void {}
+pub fn a2884() void {}
+pub fn a2885() void {}
+pub fn a2886() void {}
+pub fn a2887() void {}
+pub fn a2888() void {}
+pub fn a2889() void {}
+pub fn a2890() void {}
+pub fn a2891() void {}
+pub fn a2892() void {}
+pub fn a2893() void {}
+pub fn a2894() void {}
+pub fn a2895() void {}
+pub fn a2896() void {}
+pub fn a2897() void {}
+pub fn a2898() void {}
+pub fn a2899() void {}
+pub fn a2900() void {}
+pub fn a2901() void {}
+pub fn a2902() void {}
+pub fn a2903() void {}
+pub fn a2904() void {}
+pub fn a2905() void {}
+pub fn a2906() void {}
+pub fn a2907() void {}
+pub fn a2908() void {}
+pub fn a2909() void {}
+pub fn a2910() void {}
+pub fn a2911() void {}
+pub fn a2912() void {}
+pub fn a2913() void {}
+pub fn a2914() void {}
+pub fn a2915() void {}
+pub fn a2916() void {}
+pub fn a2917() void {}
+pub fn a2918() void {}
+pub fn a2919() void {}
+pub fn a2920() void {}
+pub fn a2921() void {}
+pub fn a2922() void {}
+pub fn a2923() void {}
+pub fn a2924() void {}
+pub fn a2925() void {}
+pub fn a2926() void {}
+pub fn a2927() void {}
+pub fn a2928() void {}
+pub fn a2929() void {}
+pub fn a2930() void {}
+pub fn a2931() void {}
+pub fn a2932() void {}
+pub fn a2933() void {}
+pub fn a2934() void {}
+pub fn a2935() void {}
+pub fn a2936() void {}
+pub fn a2937() void {}
+pub fn a2938() void {}
+pub fn a2939() void {}
+pub fn a2940() void {}
+pub fn a2941() void {}
+pub fn a2942() void {}
+pub fn a2943() void {}
+pub fn a2944() void {}
+pub fn a2945() void {}
+pub fn a2946() void {}
+pub fn a2947() void {}
+pub fn a2948() void {}
+pub fn a2949() void {}
+pub fn a2950() void {}
+pub fn a2951() void {}
+pub fn a2952() void {}
+pub fn a2953() void {}
+pub fn a2954() void {}
+pub fn a2955() void {}
+pub fn a2956() void {}
+pub fn a2957() void {}
+pub fn a2958() void {}
+pub fn a2959() void {}
+pub fn a2960() void {}
+pub fn a2961() void {}
+pub fn a2962() void {}
+pub fn a2963() void {}
+pub fn a2964() void {}
+pub fn a2965() void {}
+pub fn a2966() void {}
+pub fn a2967() void {}
+pub fn a2968() void {}
+pub fn a2969() void {}
+pub fn a2970() void {}
+pub fn a2971() void {}
+pub fn a2972() void {}
+pub fn a2973() void {}
+pub fn a2974() void {}
+pub fn a2975() void {}
+pub fn a2976() void {}
+pub fn a2977() void {}
+pub fn a2978() void {}
+pub fn a2979() void {}
+pub fn a2980() void {}
+pub fn a2981() void {}
+pub fn a2982() void {}
+pub fn a2983() void {}
+pub fn a2984() void {}
+pub fn a2985() void {}
+pub fn a2986() void {}
+pub fn a2987() void {}
+pub fn a2988() void {}
+pub fn a2989() void {}
+pub fn a2990() void {}
+pub fn a2991() void {}
+pub fn a2992() void {}
+pub fn a2993() void {}
+pub fn a2994() void {}
+pub fn a2995() void {}
+pub fn a2996() void {}
+pub fn a2997() void {}
+pub fn a2998() void {}
+pub fn a2999() void {}
+pub fn a3000() void {}
+pub fn a3001() void {}
+pub fn a3002() void {}
+pub fn a3003() void {}
+pub fn a3004() void {}
+pub fn a3005() void {}
+pub fn a3006() void {}
+pub fn a3007() void {}
+pub fn a3008() void {}
+pub fn a3009() void {}
+pub fn a3010() void {}
+pub fn a3011() void {}
+pub fn a3012() void {}
+pub fn a3013() void {}
+pub fn a3014() void {}
+pub fn a3015() void {}
+pub fn a3016() void {}
+pub fn a3017() void {}
+pub fn a3018() void {}
+pub fn a3019() void {}
+pub fn a3020() void {}
+pub fn a3021() void {}
+pub fn a3022() void {}
+pub fn a3023() void {}
+pub fn a3024() void {}
+pub fn a3025() void {}
+pub fn a3026() void {}
+pub fn a3027() void {}
+pub fn a3028() void {}
+pub fn a3029() void {}
+pub fn a3030() void {}
+pub fn a3031() void {}
+pub fn a3032() void {}
+pub fn a3033() void {}
+pub fn a3034() void {}
+pub fn a3035() void {}
+pub fn a3036() void {}
+pub fn a3037() void {}
+pub fn a3038() void {}
+pub fn a3039() void {}
+pub fn a3040() void {}
+pub fn a3041() void {}
+pub fn a3042() void {}
+pub fn a3043() void {}
+pub fn a3044() void {}
+pub fn a3045() void {}
+pub fn a3046() void {}
+pub fn a3047() void {}
+pub fn a3048() void {}
+pub fn a3049() void {}
+pub fn a3050() void {}
+pub fn a3051() void {}
+pub fn a3052() void {}
+pub fn a3053() void {}
+pub fn a3054() void {}
+pub fn a3055() void {}
+pub fn a3056() void {}
+pub fn a3057() void {}
+pub fn a3058() void {}
+pub fn a3059() void {}
+pub fn a3060() void {}
+pub fn a3061() void {}
+pub fn a3062() void {}
+pub fn a3063() void {}
+pub fn a3064() void {}
+pub fn a3065() void {}
+pub fn a3066() void {}
+pub fn a3067() void {}
+pub fn a3068() void {}
+pub fn a3069() void {}
+pub fn a3070() void {}
+pub fn a3071() void {}
+pub fn a3072() void {}
+pub fn a3073() void {}
+pub fn a3074() void {}
+pub fn a3075() void {}
+pub fn a3076() void {}
+pub fn a3077() void {}
+pub fn a3078() void {}
+pub fn a3079() void {}
+pub fn a3080() void {}
+pub fn a3081() void {}
+pub fn a3082() void {}
+pub fn a3083() void {}
+pub fn a3084() void {}
+pub fn a3085() void {}
+pub fn a3086() void {}
+pub fn a3087() void {}
+pub fn a3088() void {}
+pub fn a3089() void {}
+pub fn a3090() void {}
+pub fn a3091() void {}
+pub fn a3092() void {}
+pub fn a3093() void {}
+pub fn a3094() void {}
+pub fn a3095() void {}
+pub fn a3096() void {}
+pub fn a3097() void {}
+pub fn a3098() void {}
+pub fn a3099() void {}
+pub fn main() void {
+  a3099();
+  ifj.write("ok\n");
+}
@@ -0,0 +1,8 @@
+// Integer literal out of i32 range
+const ifj = @import("ifj24.zig");
+pub fn main() void {
+    const max: i32 = 2147483647;
+    const over: i32 = 2147483648;
+    ifj.write(max);
+    ifj.write(over);
+}
@@ -0,0 +1,8 @@
+// Duplicate parameter in function declared after its call
+const ifj = @import("ifj24.zig");
+pub fn main() void {
+    foo(1, 2);
+}
+pub fn foo(a: i32, a: i32) void {
+    ifj.write(a);
+}
@@ -86,6 +86,8 @@ function run_tests() {
     test "examples/example20.zig" 0
     test "examples/example21.zig" 0
     test "examples/example43.zig" 0
+    test "examples/example45.zig" 0
+    test "examples/example46.zig" 0
 
     log_info "
     ------------TESTS FOR BASE ERRORS FROM PDF------------